@@ -0,0 +1,139 @@
+/*
+ * main.cpp
+ * Copyright (C) 2013 David Jolly
+ * ----------------------
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <new>
+#include <string>
+#include "..\..\test\bench.h"
+
+/*
+ * Allocate memory, counting the allocation
+ * @param size allocation size in bytes
+ * @return pointer to allocated memory
+ */
+void *
+operator new(
+	size_t size
+	)
+{
+	void *result = std::malloc(size ? size : 1);
+
+	if(!result) {
+		throw std::bad_alloc();
+	}
+	bench_add_allocation();
+
+	return result;
+}
+
+/*
+ * Free memory
+ * @param ptr pointer to allocated memory
+ */
+void 
+operator delete(
+	void *ptr
+	) throw()
+{
+	std::free(ptr);
+}
+
+/*
+ * Main
+ */
+int 
+main(
+	int argc,
+	char **argv
+	)
+{
+	int i = 1;
+	gen_config config;
+	std::string baseline, flag, generate, output;
+	double threshold = BENCH_DEFAULT_THRESHOLD;
+	size_t param = GEN_PARAM_STATEMENTS, repetitions = BENCH_DEFAULT_REPETITIONS, 
+		warmup = BENCH_DEFAULT_WARMUP;
+
+	gen_config_default(config);
+
+	for(; i < argc; ++i) {
+		flag = argv[i];
+
+		if(flag == BENCH_FLAG_HELP) {
+			std::cout << BENCH_USAGE << std::endl;
+			return 0;
+		} else if(!IS_BENCH_VALUE_FLAG(flag)) {
+			std::cerr << BENCH_USAGE << std::endl;
+			return 1;
+		} else if(i + 1 >= argc) {
+			std::cerr << "Missing value for argument: " << flag << std::endl;
+			return 1;
+		}
+
+		if(flag == "-b") {
+			baseline = argv[++i];
+		} else if(flag == "-g") {
+			generate = argv[++i];
+		} else if(flag == "-o") {
+			output = argv[++i];
+		} else if(flag == "-p") {
+
+			if(!gen_config_set(config, argv[++i])) {
+				std::cerr << "Invalid generator parameter: " << argv[i] << std::endl;
+				return 1;
+			}
+		} else if(flag == "-r") {
+			repetitions = (size_t) std::strtoul(argv[++i], NULL, 10);
+		} else if(flag == "-s") {
+
+			for(flag = argv[++i], param = 0; param <= MAX_GEN_PARAM; ++param) {
+
+				if(flag == GEN_PARAM_STRING(param)) {
+					break;
+				}
+			}
+
+			if(param > MAX_GEN_PARAM) {
+				std::cerr << "Invalid generator parameter: " << flag << std::endl;
+				return 1;
+			}
+		} else if(flag == "-t") {
+			threshold = std::strtod(argv[++i], NULL);
+		} else if(flag == "-w") {
+			warmup = (size_t) std::strtoul(argv[++i], NULL, 10);
+		}
+	}
+
+	if(!generate.empty()) {
+		std::ofstream file(generate.c_str(), std::ios::out | std::ios::trunc);
+
+		if(!file
+				|| !gen_write_modules(config, generate + GEN_MODULE_INFIX)) {
+			std::cerr << "Failed to write generated program: " << generate << std::endl;
+			return 1;
+		}
+		file << gen_program(config, generate + GEN_MODULE_INFIX);
+
+		return 0;
+	}
+
+	return bench_test_all(config, param, warmup, repetitions, threshold, baseline, output) ? 0 : 1;
+}
@@ -0,0 +1,107 @@
+/*
+ * atm.cpp
+ * Copyright (C) 2013 David Jolly
+ * ----------------------
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <sstream>
+#include <stdexcept>
+#include "atm.h"
+
+//#define ATM_TRACING
+#ifndef ATM_TRACING
+#define TRACE_SUBSYSTEM TRC_SUBSYSTEM_COMMON
+#include "trace.h"
+#else
+#define TRACE_HEADER "atm"
+#include "trace.h"
+#endif
+
+std::atomic<size_t> _atm::_count(ATM_INVALID_ID + 1);
+
+std::map<std::string, size_t> _atm::_ids;
+
+std::string *_atm::_text[ATM_BLOCK_COUNT] = { NULL };
+
+std::mutex _atm::_lock;
+
+_atm::_atm(void)
+{
+	return;
+}
+
+size_t 
+_atm::get_count(void)
+{
+	return _count.load(std::memory_order_acquire) - 1;
+}
+
+const std::string &
+_atm::get_text(
+	size_t id
+	)
+{
+
+	if(id == ATM_INVALID_ID
+			|| id >= _count.load(std::memory_order_acquire)) {
+		TRACE_EVENT("Invalid atom id: " << id, TRACE_TYPE_ERROR);
+		THROW_ATM_EXC_W_MESS(id, ATM_EXC_INVALID_ID);
+	}
+
+	return _text[id / ATM_BLOCK_LENGTH][id % ATM_BLOCK_LENGTH];
+}
+
+size_t 
+_atm::intern(
+	const std::string &text
+	)
+{
+	TRACE_EVENT("+_atm::intern", TRACE_TYPE_VERBOSE);
+
+	size_t block, result;
+	std::map<std::string, size_t>::iterator entry;
+	std::lock_guard<std::mutex> guard(_lock);
+
+	result = _count.load(std::memory_order_relaxed);
+	entry = _ids.find(text);
+
+	if(entry == _ids.end()) {
+
+		if(result > ATM_MAX_COUNT) {
+			TRACE_EVENT("Atom table is full: " << text, TRACE_TYPE_ERROR);
+			THROW_ATM_EXC_W_MESS(text, ATM_EXC_TABLE_FULL);
+		}
+		block = result / ATM_BLOCK_LENGTH;
+
+		if(!_text[block]) {
+			_text[block] = new std::string[ATM_BLOCK_LENGTH];
+
+			if(!_text[block]) {
+				TRACE_EVENT("Failed to allocate atom block: " << block, TRACE_TYPE_ERROR);
+				THROW_ATM_EXC_W_MESS(block, ATM_EXC_OUT_OF_MEMORY);
+			}
+		}
+		_text[block][result % ATM_BLOCK_LENGTH] = text;
+		_ids.insert(std::pair<std::string, size_t>(text, result));
+		_count.store(result + 1, std::memory_order_release);
+	} else {
+		result = entry->second;
+	}
+
+	TRACE_EVENT("-_atm::intern", TRACE_TYPE_VERBOSE);
+
+	return result;
+}
@@ -0,0 +1,99 @@
+/*
+ * atm.h
+ * Copyright (C) 2013 David Jolly
+ * ----------------------
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef ATM_H_
+#define ATM_H_
+
+#include <atomic>
+#include <map>
+#include <mutex>
+#include "atm_type.h"
+
+/*
+ * Atom table class
+ * (interns identifier names so tokens and contexts can refer to them
+ * by a small integer id; atoms live for the lifetime of the process,
+ * the table is shared by all threads and holds at most ATM_MAX_COUNT
+ * atoms)
+ */
+typedef class _atm {
+
+	public:
+
+		/*
+		 * Retrieve interned atom count
+		 * @return interned atom count
+		 */
+		static size_t get_count(void);
+
+		/*
+		 * Retrieve atom text at a given id
+		 * @param id atom id
+		 * @return atom text string reference
+		 */
+		static const std::string &get_text(
+			size_t id
+			);
+
+		/*
+		 * Intern a given text string
+		 * (throws once the table is full)
+		 * @param text text string reference
+		 * @return atom id
+		 */
+		static size_t intern(
+			const std::string &text
+			);
+
+	protected:
+
+		/*
+		 * Atom table constructor
+		 * (the atom table is only accessed through static routines)
+		 */
+		_atm(void);
+
+		/*
+		 * Atom count, including the reserved invalid id
+		 * (stored with release ordering once an atom is in place, so readers
+		 * holding an id below it can index the text blocks without locking)
+		 */
+		static std::atomic<size_t> _count;
+
+		/*
+		 * Atom ids, keyed by text
+		 */
+		static std::map<std::string, size_t> _ids;
+
+		/*
+		 * Atom text blocks, indexed by id
+		 * (blocks are allocated on demand and never moved or freed, keeping
+		 * returned references stable as the table grows)
+		 */
+		static std::string *_text[ATM_BLOCK_COUNT];
+
+		/*
+		 * Atom table lock
+		 * (serializes interning, lookups by id do not take it)
+		 */
+		static std::mutex _lock;
+
+} atm, *atm_ptr;
+
+#endif
@@ -0,0 +1,87 @@
+/*
+ * atm_type.h
+ * Copyright (C) 2013 David Jolly
+ * ----------------------
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef ATM_TYPE_H_
+#define ATM_TYPE_H_
+
+#include <string>
+
+/*
+ * Atom exception types
+ */
+enum {
+	ATM_EXC_INVALID_ID = 0,
+	ATM_EXC_OUT_OF_MEMORY,
+	ATM_EXC_TABLE_FULL,
+};
+
+/*
+ * Max atom types
+ */
+#define MAX_ATM_EXC_TYPE ATM_EXC_TABLE_FULL
+
+/*
+ * Atom identifiers
+ * (id zero is reserved for text that has not been interned)
+ */
+#define ATM_INVALID_ID 0
+
+/*
+ * Atom table limits
+ */
+#define ATM_MAX_COUNT 0x100000
+
+/*
+ * Atom table block length
+ * (atom text is stored in fixed blocks that are never moved, so readers
+ * never observe a table being resized)
+ */
+#define ATM_BLOCK_LENGTH 0x400
+#define ATM_BLOCK_COUNT ((ATM_MAX_COUNT / ATM_BLOCK_LENGTH) + 1)
+
+/*
+ * Atom strings
+ */
+static const std::string ATM_EXC_STR[] = {
+	"Invalid atom id",
+	"Failed to allocate atom block",
+	"Atom table is full",
+};
+
+/*
+ * Atom string lookup macros
+ */
+#define ATM_EXC_STRING(_T_) (_T_ > MAX_ATM_EXC_TYPE ? "Unknown atom exception type" : ATM_EXC_STR[_T_])
+
+/*
+ * Atom exception macros
+ */
+#define THROW_ATM_EXC(_T_) {\
+	std::stringstream ss;\
+	ss << ATM_EXC_STRING(_T_);\
+	throw std::runtime_error(ss.str().c_str());\
+	}
+	
+#define THROW_ATM_EXC_W_MESS(_M_, _T_) {\
+	std::stringstream ss;\
+	ss << ATM_EXC_STRING(_T_) << ": " << _M_;\
+	throw std::runtime_error(ss.str().c_str());\
+	}
+
+#endif
@@ -0,0 +1,237 @@
+/*
+ * bud.cpp
+ * Copyright (C) 2013 David Jolly
+ * ----------------------
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <cstring>
+#include <sstream>
+#include <stdexcept>
+#include "bud.h"
+#include "clk.h"
+
+//#define BUD_TRACING
+#ifndef BUD_TRACING
+#define TRACE_SUBSYSTEM TRC_SUBSYSTEM_EXECUTOR
+#include "trace.h"
+#else
+#define TRACE_HEADER "bud"
+#include "trace.h"
+#endif
+
+_bud::_bud(void) :
+	_enabled(false)
+{
+	TRACE_EVENT("+_bud::_bud", TRACE_TYPE_INFORMATION);
+
+	memset(_limits, 0, sizeof(unsigned long long) * (MAX_BUD_LIMIT_TYPE + 1));
+	start();
+
+	TRACE_EVENT("-_bud::_bud", TRACE_TYPE_INFORMATION);
+}
+
+_bud::_bud(
+	const _bud &other
+	) :
+		_checks(other._checks),
+		_enabled(other._enabled),
+		_exhausted(other._exhausted),
+		_start(other._start)
+{
+	TRACE_EVENT("+_bud::_bud", TRACE_TYPE_INFORMATION);
+
+	memcpy(_counts, other._counts, sizeof(unsigned long long) * (MAX_BUD_LIMIT_TYPE + 1));
+	memcpy(_limits, other._limits, sizeof(unsigned long long) * (MAX_BUD_LIMIT_TYPE + 1));
+
+	TRACE_EVENT("-_bud::_bud", TRACE_TYPE_INFORMATION);
+}
+
+_bud::~_bud(void)
+{
+	TRACE_EVENT("+_bud::~_bud", TRACE_TYPE_INFORMATION);
+	TRACE_EVENT("-_bud::~_bud", TRACE_TYPE_INFORMATION);
+}
+
+_bud &
+_bud::operator=(
+	const _bud &other
+	)
+{
+	TRACE_EVENT("+_bud::operator=", TRACE_TYPE_INFORMATION);
+
+	if(this != &other) {
+		_checks = other._checks;
+		_enabled = other._enabled;
+		_exhausted = other._exhausted;
+		_start = other._start;
+		memcpy(_counts, other._counts, sizeof(unsigned long long) * (MAX_BUD_LIMIT_TYPE + 1));
+		memcpy(_limits, other._limits, sizeof(unsigned long long) * (MAX_BUD_LIMIT_TYPE + 1));
+	}
+
+	TRACE_EVENT("-_bud::operator=", TRACE_TYPE_INFORMATION);
+
+	return *this;
+}
+
+void 
+_bud::add_expression(void)
+{
+	++_counts[BUD_LIMIT_EXPRESSION];
+}
+
+void 
+_bud::add_statement(void)
+{
+	++_counts[BUD_LIMIT_STATEMENT];
+}
+
+void 
+_bud::check(void)
+{
+	size_t type = BUD_LIMIT_EXPRESSION;
+
+	if(_exhausted > MAX_BUD_LIMIT_TYPE) {
+
+		for(; type <= MAX_BUD_LIMIT_TYPE; ++type) {
+
+			if(_limits[type]
+					&& (_counts[type] > _limits[type])) {
+				_exhausted = type;
+				break;
+			}
+		}
+
+		if((_exhausted > MAX_BUD_LIMIT_TYPE)
+				&& _limits[BUD_LIMIT_DEADLINE]
+				&& !(++_checks & (BUD_CLOCK_INTERVAL - 1))
+				&& (get_count(BUD_LIMIT_DEADLINE) > _limits[BUD_LIMIT_DEADLINE])) {
+			_exhausted = BUD_LIMIT_DEADLINE;
+		}
+	}
+
+	if(_exhausted <= MAX_BUD_LIMIT_TYPE) {
+		TRACE_EVENT("Execution budget exhausted: " << BUD_LIMIT_STRING(_exhausted), TRACE_TYPE_WARNING);
+		THROW_BUD_EXC_W_MESS(BUD_LIMIT_STRING(_exhausted) << " (limit " << _limits[_exhausted] << " " 
+			<< BUD_LIMIT_UNIT_STRING(_exhausted) << ")", BUD_EXC_EXHAUSTED);
+	}
+}
+
+unsigned long long 
+_bud::get_count(
+	size_t type
+	)
+{
+	unsigned long long result = 0;
+
+	if(type == BUD_LIMIT_DEADLINE) {
+		result = clk::now() - _start;
+	} else if(type <= MAX_BUD_LIMIT_TYPE) {
+		result = _counts[type];
+	}
+
+	return result;
+}
+
+size_t 
+_bud::get_exhausted(void)
+{
+	return _exhausted;
+}
+
+unsigned long long 
+_bud::get_limit(
+	size_t type
+	)
+{
+	return (type <= MAX_BUD_LIMIT_TYPE) ? _limits[type] : 0;
+}
+
+bool 
+_bud::is_enabled(void)
+{
+	return _enabled;
+}
+
+bool 
+_bud::is_exhausted(void)
+{
+	return _exhausted <= MAX_BUD_LIMIT_TYPE;
+}
+
+void 
+_bud::set_limit(
+	size_t type,
+	unsigned long long limit
+	)
+{
+	TRACE_EVENT("+_bud::set_limit", TRACE_TYPE_INFORMATION);
+
+	size_t i = 0;
+
+	if(type > MAX_BUD_LIMIT_TYPE) {
+		TRACE_EVENT("Invalid budget limit type: " << type, TRACE_TYPE_ERROR);
+		THROW_BUD_EXC_W_MESS(type, BUD_EXC_INVALID_LIMIT);
+	}
+	_limits[type] = limit;
+	_enabled = false;
+
+	for(; i <= MAX_BUD_LIMIT_TYPE; ++i) {
+		_enabled = _enabled || _limits[i];
+	}
+
+	TRACE_EVENT("-_bud::set_limit", TRACE_TYPE_INFORMATION);
+}
+
+void 
+_bud::start(void)
+{
+	TRACE_EVENT("+_bud::start", TRACE_TYPE_INFORMATION);
+
+	_checks = 0;
+	_exhausted = MAX_BUD_LIMIT_TYPE + 1;
+	_start = clk::now();
+	memset(_counts, 0, sizeof(unsigned long long) * (MAX_BUD_LIMIT_TYPE + 1));
+
+	TRACE_EVENT("-_bud::start", TRACE_TYPE_INFORMATION);
+}
+
+std::string 
+_bud::to_string(void)
+{
+	TRACE_EVENT("+_bud::to_string", TRACE_TYPE_INFORMATION);
+
+	size_t type = 0;
+	std::stringstream ss;
+
+	ss << "Budget:";
+
+	for(; type <= MAX_BUD_LIMIT_TYPE; ++type) {
+		ss << std::endl << "  " << BUD_LIMIT_STRING(type) << ": " << get_count(type);
+
+		if(_limits[type]) {
+			ss << "/" << _limits[type];
+		}
+		ss << " " << BUD_LIMIT_UNIT_STRING(type);
+
+		if(type == _exhausted) {
+			ss << " (exhausted)";
+		}
+	}
+
+	TRACE_EVENT("-_bud::to_string", TRACE_TYPE_INFORMATION);
+
+	return ss.str();
+}
@@ -0,0 +1,170 @@
+/*
+ * bud.h
+ * Copyright (C) 2013 David Jolly
+ * ----------------------
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef BUD_H_
+#define BUD_H_
+
+#include "bud_type.h"
+
+/*
+ * Execution budget class
+ * (limits evaluated statements, evaluated expressions and wall-clock
+ * time; counts are cheap, and limits are only tested at loop back-edges
+ * and function calls)
+ */
+typedef class _bud {
+
+	public:
+
+		/*
+		 * Budget constructor
+		 */
+		_bud(void);
+
+		/*
+		 * Budget constructor
+		 * @param other budget object reference
+		 */
+		_bud(
+			const _bud &other
+			);
+
+		/*
+		 * Budget destructor
+		 */
+		virtual ~_bud(void);
+
+		/*
+		 * Budget assignment operator
+		 * @param other budget object reference
+		 * @return budget object reference
+		 */
+		_bud &operator=(
+			const _bud &other
+			);
+
+		/*
+		 * Add an evaluated expression
+		 */
+		void add_expression(void);
+
+		/*
+		 * Add an evaluated statement
+		 */
+		void add_statement(void);
+
+		/*
+		 * Test all limits, throwing once any is exhausted
+		 */
+		void check(void);
+
+		/*
+		 * Retrieve a budget count
+		 * @param type limit type
+		 * @return count, or elapsed nanoseconds for the deadline
+		 */
+		unsigned long long get_count(
+			size_t type
+			);
+
+		/*
+		 * Retrieve the exhausted limit
+		 * @return exhausted limit type
+		 */
+		size_t get_exhausted(void);
+
+		/*
+		 * Retrieve a budget limit
+		 * @param type limit type
+		 * @return limit, zero if unlimited
+		 */
+		unsigned long long get_limit(
+			size_t type
+			);
+
+		/*
+		 * Retrieve enabled status
+		 * @return true if any limit is set, false otherwise
+		 */
+		bool is_enabled(void);
+
+		/*
+		 * Retrieve exhausted status
+		 * @return true if a limit was exhausted, false otherwise
+		 */
+		bool is_exhausted(void);
+
+		/*
+		 * Set a budget limit
+		 * @param type limit type
+		 * @param limit limit, zero if unlimited (the deadline is in
+		 * nanoseconds after start)
+		 */
+		void set_limit(
+			size_t type,
+			unsigned long long limit
+			);
+
+		/*
+		 * Start the budget, clearing all counts
+		 * (limits are kept)
+		 */
+		void start(void);
+
+		/*
+		 * Retrieve string represenation
+		 * @return string represenation
+		 */
+		std::string to_string(void);
+
+	protected:
+
+		/*
+		 * Budget checks since the last clock test
+		 */
+		size_t _checks;
+
+		/*
+		 * Budget counts, indexed by limit type
+		 */
+		unsigned long long _counts[MAX_BUD_LIMIT_TYPE + 1];
+
+		/*
+		 * Budget enabled status
+		 */
+		bool _enabled;
+
+		/*
+		 * Budget exhausted limit type, past the max limit type if none
+		 */
+		size_t _exhausted;
+
+		/*
+		 * Budget limits, indexed by limit type
+		 */
+		unsigned long long _limits[MAX_BUD_LIMIT_TYPE + 1];
+
+		/*
+		 * Budget start time, in nanoseconds
+		 */
+		unsigned long long _start;
+
+} bud, *bud_ptr;
+
+#endif
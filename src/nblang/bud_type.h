@@ -0,0 +1,96 @@
+/*
+ * bud_type.h
+ * Copyright (C) 2013 David Jolly
+ * ----------------------
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef BUD_TYPE_H_
+#define BUD_TYPE_H_
+
+#include <string>
+
+class _bud;
+typedef _bud bud, *bud_ptr;
+
+/*
+ * Budget exception types
+ */
+enum {
+	BUD_EXC_EXHAUSTED = 0,
+	BUD_EXC_INVALID_LIMIT,
+};
+
+/*
+ * Budget limit types
+ */
+enum {
+	BUD_LIMIT_DEADLINE = 0,
+	BUD_LIMIT_EXPRESSION,
+	BUD_LIMIT_STATEMENT,
+};
+
+/*
+ * Max budget types
+ */
+#define MAX_BUD_EXC_TYPE BUD_EXC_INVALID_LIMIT
+#define MAX_BUD_LIMIT_TYPE BUD_LIMIT_STATEMENT
+
+/*
+ * Budget clock interval, in checks
+ * (the deadline is tested against the clock once per interval; must be
+ * a power of two)
+ */
+#define BUD_CLOCK_INTERVAL 0x20
+
+/*
+ * Budget strings
+ */
+static const std::string BUD_EXC_STR[] = {
+	"Execution budget exhausted",
+	"Invalid budget limit type",
+};
+
+static const std::string BUD_LIMIT_STR[] = {
+	"deadline", "expressions", "statements",
+};
+
+static const std::string BUD_LIMIT_UNIT_STR[] = {
+	"ns", "expressions", "statements",
+};
+
+/*
+ * Budget string lookup macros
+ */
+#define BUD_EXC_STRING(_T_) (_T_ > MAX_BUD_EXC_TYPE ? "Unknown budget exception type" : BUD_EXC_STR[_T_])
+#define BUD_LIMIT_STRING(_T_) (_T_ > MAX_BUD_LIMIT_TYPE ? "unknown" : BUD_LIMIT_STR[_T_])
+#define BUD_LIMIT_UNIT_STRING(_T_) (_T_ > MAX_BUD_LIMIT_TYPE ? "unknown" : BUD_LIMIT_UNIT_STR[_T_])
+
+/*
+ * Budget exception macros
+ */
+#define THROW_BUD_EXC(_T_) {\
+	std::stringstream ss;\
+	ss << BUD_EXC_STRING(_T_);\
+	throw std::runtime_error(ss.str().c_str());\
+	}
+	
+#define THROW_BUD_EXC_W_MESS(_M_, _T_) {\
+	std::stringstream ss;\
+	ss << BUD_EXC_STRING(_T_) << ": " << _M_;\
+	throw std::runtime_error(ss.str().c_str());\
+	}
+
+#endif
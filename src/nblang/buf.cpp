@@ -0,0 +1,344 @@
+/*
+ * buf.cpp
+ * Copyright (C) 2013 David Jolly
+ * ----------------------
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <algorithm>
+#include <fstream>
+#include <sstream>
+#include <stdexcept>
+#include "buf.h"
+#include "lang.h"
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+//#define BUF_TRACING
+#ifndef BUF_TRACING
+#define TRACE_SUBSYSTEM TRC_SUBSYSTEM_COMMON
+#include "trace.h"
+#else
+#define TRACE_HEADER "buf"
+#include "trace.h"
+#endif
+
+std::set<buf_ptr> _buf::_mapped_set;
+
+std::recursive_mutex _buf::_mapped_lock;
+
+_buf::_buf(void) :
+	_data(NULL),
+	_size(0),
+	_device(0),
+	_inode(0),
+	_modified(0),
+	_mapped(false),
+	_references(1)
+{
+	TRACE_EVENT("+_buf::_buf", TRACE_TYPE_INFORMATION);
+	TRACE_EVENT("-_buf::_buf", TRACE_TYPE_INFORMATION);
+}
+
+_buf::_buf(
+	const _buf &other
+	) :
+		_data(NULL),
+		_size(0),
+		_device(0),
+		_inode(0),
+		_modified(0),
+		_mapped(false),
+		_references(1)
+{
+	TRACE_EVENT("+_buf::_buf", TRACE_TYPE_INFORMATION);
+
+	UNREF_PARAM(other);
+
+	TRACE_EVENT("-_buf::_buf", TRACE_TYPE_INFORMATION);
+}
+
+_buf::~_buf(void)
+{
+	TRACE_EVENT("+_buf::~_buf", TRACE_TYPE_INFORMATION);
+
+	_unmap();
+
+	TRACE_EVENT("-_buf::~_buf", TRACE_TYPE_INFORMATION);
+}
+
+_buf &
+_buf::operator=(
+	const _buf &other
+	)
+{
+	TRACE_EVENT("_buf::operator=", TRACE_TYPE_INFORMATION);
+
+	UNREF_PARAM(other);
+
+	return *this;
+}
+
+void 
+_buf::_detach(
+	size_t length
+	)
+{
+	TRACE_EVENT("+_buf::_detach", TRACE_TYPE_VERBOSE);
+
+	std::string text;
+
+	if(_mapped) {
+		text.assign(_data, std::min(length, _size));
+		_unmap();
+		_text.swap(text);
+		_data = _text.c_str();
+		_size = _text.size();
+	}
+
+	TRACE_EVENT("-_buf::_detach", TRACE_TYPE_VERBOSE);
+}
+
+void 
+_buf::_unmap(void)
+{
+	TRACE_EVENT("+_buf::_unmap", TRACE_TYPE_VERBOSE);
+
+#ifndef _WIN32
+	if(_mapped) {
+		std::lock_guard<std::recursive_mutex> guard(_mapped_lock);
+
+		munmap((void *) _data, _size);
+		_mapped_set.erase(this);
+		_mapped = false;
+	}
+#endif
+	_text.clear();
+	_data = NULL;
+	_size = 0;
+	_path.clear();
+	_device = 0;
+	_inode = 0;
+	_modified = 0;
+
+	TRACE_EVENT("-_buf::_unmap", TRACE_TYPE_VERBOSE);
+}
+
+void 
+_buf::detach(
+	const std::string &path
+	)
+{
+	TRACE_EVENT("+_buf::detach", TRACE_TYPE_INFORMATION);
+
+#ifndef _WIN32
+	struct stat status;
+	std::set<buf_ptr> detach_set;
+	std::set<buf_ptr>::iterator iter;
+	std::lock_guard<std::recursive_mutex> guard(_mapped_lock);
+
+	if(!_mapped_set.empty()
+			&& !stat(path.c_str(), &status)) {
+
+		for(iter = _mapped_set.begin(); iter != _mapped_set.end(); ++iter) {
+
+			if((*iter)->_device == (unsigned long long) status.st_dev
+					&& (*iter)->_inode == (unsigned long long) status.st_ino) {
+				detach_set.insert(*iter);
+			}
+		}
+
+		for(iter = detach_set.begin(); iter != detach_set.end(); ++iter) {
+			TRACE_EVENT("Detaching mapped file: " << path, TRACE_TYPE_VERBOSE);
+			(*iter)->_detach((*iter)->_size);
+		}
+	}
+#else
+	UNREF_PARAM(path);
+#endif
+
+	TRACE_EVENT("-_buf::detach", TRACE_TYPE_INFORMATION);
+}
+
+void 
+_buf::detach_all(void)
+{
+	TRACE_EVENT("+_buf::detach_all", TRACE_TYPE_INFORMATION);
+
+#ifndef _WIN32
+	std::set<buf_ptr> detach_set;
+	std::set<buf_ptr>::iterator iter;
+	std::lock_guard<std::recursive_mutex> guard(_mapped_lock);
+
+	detach_set = _mapped_set;
+
+	for(iter = detach_set.begin(); iter != detach_set.end(); ++iter) {
+		(*iter)->_detach((*iter)->_size);
+	}
+#endif
+
+	TRACE_EVENT("-_buf::detach_all", TRACE_TYPE_INFORMATION);
+}
+
+const char *
+_buf::get_data(void)
+{
+	TRACE_EVENT("_buf::get_data", TRACE_TYPE_VERBOSE);
+
+	return _data;
+}
+
+size_t 
+_buf::get_size(void)
+{
+	TRACE_EVENT("_buf::get_size", TRACE_TYPE_VERBOSE);
+
+	return _size;
+}
+
+bool 
+_buf::is_mapped(void) const
+{
+	TRACE_EVENT("_buf::is_mapped", TRACE_TYPE_VERBOSE);
+
+	return _mapped;
+}
+
+bool 
+_buf::open(
+	const std::string &path,
+	bool is_binary
+	)
+{
+	TRACE_EVENT("+_buf::open", TRACE_TYPE_INFORMATION);
+
+	bool result = false;
+	std::stringstream ss;
+
+	_unmap();
+
+#ifndef _WIN32
+	int fd;
+	void *data;
+	struct stat status;
+
+	fd = ::open(path.c_str(), O_RDONLY);
+
+	if(fd >= 0) {
+
+		if(!fstat(fd, &status)
+				&& S_ISREG(status.st_mode)
+				&& status.st_size >= BUF_MAP_MIN_SIZE) {
+			data = mmap(NULL, (size_t) status.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+
+			if(data != MAP_FAILED) {
+				TRACE_EVENT("Mapped file: " << path << " (" << status.st_size << " bytes)", TRACE_TYPE_VERBOSE);
+				std::lock_guard<std::recursive_mutex> guard(_mapped_lock);
+
+				_data = (const char *) data;
+				_size = (size_t) status.st_size;
+				_path = path;
+				_device = (unsigned long long) status.st_dev;
+				_inode = (unsigned long long) status.st_ino;
+				_modified = BUF_MODIFIED_TIME(status);
+				_mapped = true;
+				_mapped_set.insert(this);
+				result = true;
+			}
+		}
+		close(fd);
+	}
+#endif
+
+	if(!result) {
+		std::ios::openmode mode = std::ios::in;
+
+		if(is_binary) {
+			mode |= std::ios::binary;
+		}
+
+		std::ifstream file(path.c_str(), mode);
+
+		if(file) {
+			ss << file.rdbuf();
+			_text = ss.str();
+			_data = _text.c_str();
+			_size = _text.size();
+			file.close();
+			result = true;
+		}
+	}
+
+	TRACE_EVENT("-_buf::open", TRACE_TYPE_INFORMATION);
+
+	return result;
+}
+
+void 
+_buf::reference(void)
+{
+	TRACE_EVENT("_buf::reference", TRACE_TYPE_VERBOSE);
+
+	++_references;
+}
+
+void 
+_buf::release(void)
+{
+	TRACE_EVENT("_buf::release", TRACE_TYPE_VERBOSE);
+
+	if(!--_references) {
+		delete this;
+	}
+}
+
+std::string 
+_buf::to_string(void)
+{
+	TRACE_EVENT("_buf::to_string", TRACE_TYPE_VERBOSE);
+
+	return std::string(_data ? _data : "", _size);
+}
+
+void 
+_buf::validate(void)
+{
+	TRACE_EVENT("+_buf::validate", TRACE_TYPE_VERBOSE);
+
+#ifndef _WIN32
+	struct stat status;
+
+	if(_mapped) {
+
+		if(stat(_path.c_str(), &status)
+				|| _device != (unsigned long long) status.st_dev
+				|| _inode != (unsigned long long) status.st_ino) {
+			TRACE_EVENT("Detaching replaced file: " << _path, TRACE_TYPE_WARNING);
+			_detach(_size);
+		} else if(_size != (size_t) status.st_size
+				|| _modified != BUF_MODIFIED_TIME(status)) {
+			TRACE_EVENT("Detaching modified file: " << _path, TRACE_TYPE_WARNING);
+			_detach((size_t) status.st_size);
+		}
+	}
+#endif
+
+	TRACE_EVENT("-_buf::validate", TRACE_TYPE_VERBOSE);
+}
@@ -0,0 +1,184 @@
+/*
+ * buf.h
+ * Copyright (C) 2013 David Jolly
+ * ----------------------
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef BUF_H_
+#define BUF_H_
+
+#include <mutex>
+#include <set>
+#include "buf_type.h"
+
+/*
+ * Buffer class
+ * (reference counted, immutable file contents; large files are mapped
+ * read-only rather than copied into memory, and are copied into memory
+ * before the executor writes the file or spawns a process, or once the
+ * file is seen to change underneath the mapping)
+ */
+typedef class _buf {
+
+	public:
+
+		/*
+		 * Buffer constructor
+		 */
+		_buf(void);
+
+		/*
+		 * Buffer destructor
+		 */
+		virtual ~_buf(void);
+
+		/*
+		 * Detach all mapped buffers backed by the file at a given path
+		 * (called before the file is opened for writing)
+		 * @param path file path string reference
+		 */
+		static void detach(
+			const std::string &path
+			);
+
+		/*
+		 * Detach all mapped buffers
+		 * (called before spawning a process, which may write any file)
+		 */
+		static void detach_all(void);
+
+		/*
+		 * Retrieve buffer data
+		 * (call validate first, once per value access)
+		 * @return buffer data pointer
+		 */
+		const char *get_data(void);
+
+		/*
+		 * Retrieve buffer size
+		 * @return buffer size in bytes
+		 */
+		size_t get_size(void);
+
+		/*
+		 * Check if buffer is mapped
+		 * @return true if mapped, false otherwise
+		 */
+		bool is_mapped(void) const;
+
+		/*
+		 * Load file contents at a given path
+		 * @param path file path string reference
+		 * @param is_binary true to read in binary mode, false otherwise
+		 * @return true on success, false if the file could not be opened
+		 */
+		bool open(
+			const std::string &path,
+			bool is_binary
+			);
+
+		/*
+		 * Add a buffer reference
+		 */
+		void reference(void);
+
+		/*
+		 * Remove a buffer reference, freeing the buffer with the last one
+		 */
+		void release(void);
+
+		/*
+		 * Retrieve buffer contents as a string
+		 * (call validate first, once per value access)
+		 * @return buffer contents string
+		 */
+		std::string to_string(void);
+
+		/*
+		 * Detach a mapped buffer whose file changed since it was mapped
+		 * (any change of identity, size or modification time; pages past a
+		 * truncated end of file would fault on access)
+		 */
+		void validate(void);
+
+	protected:
+
+		/*
+		 * Buffer constructor
+		 * (buffers are shared by reference, never copied)
+		 * @param other buffer object reference
+		 */
+		_buf(
+			const _buf &other
+			);
+
+		/*
+		 * Buffer assignment operator
+		 * (buffers are shared by reference, never copied)
+		 * @param other buffer object reference
+		 * @return buffer object reference
+		 */
+		_buf &operator=(
+			const _buf &other
+			);
+
+		/*
+		 * Copy mapped contents into memory and unmap the file
+		 * @param length number of leading bytes to keep
+		 */
+		void _detach(
+			size_t length
+			);
+
+		/*
+		 * Unmap the file or free in-memory contents
+		 */
+		void _unmap(void);
+
+		/*
+		 * Buffer contents
+		 */
+		const char *_data;
+		size_t _size;
+		std::string _text;
+
+		/*
+		 * Mapped file identity
+		 */
+		std::string _path;
+		unsigned long long _device;
+		unsigned long long _inode;
+		unsigned long long _modified;
+		bool _mapped;
+
+		/*
+		 * Buffer reference count
+		 */
+		size_t _references;
+
+		/*
+		 * Live mapped buffers
+		 */
+		static std::set<buf_ptr> _mapped_set;
+
+		/*
+		 * Live mapped buffers lock
+		 */
+		static std::recursive_mutex _mapped_lock;
+
+} buf, *buf_ptr;
+
+#endif
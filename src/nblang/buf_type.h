@@ -0,0 +1,84 @@
+/*
+ * buf_type.h
+ * Copyright (C) 2013 David Jolly
+ * ----------------------
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef BUF_TYPE_H_
+#define BUF_TYPE_H_
+
+#include <string>
+
+class _buf;
+typedef _buf buf, *buf_ptr;
+
+/*
+ * Buffer exception types
+ */
+enum {
+	BUF_EXC_OUT_OF_MEMORY = 0,
+};
+
+/*
+ * Max buffer types
+ */
+#define MAX_BUF_EXC_TYPE BUF_EXC_OUT_OF_MEMORY
+
+/*
+ * Buffer mapping limits
+ * (files smaller than this are read into memory rather than mapped)
+ */
+#define BUF_MAP_MIN_SIZE 0x10000
+
+/*
+ * Buffer mapped file modification time, in nanoseconds
+ */
+#ifdef __APPLE__
+#define BUF_MODIFIED_TIME(_S_) (((unsigned long long) (_S_).st_mtimespec.tv_sec * 1000000000ULL)\
+	+ (unsigned long long) (_S_).st_mtimespec.tv_nsec)
+#else
+#define BUF_MODIFIED_TIME(_S_) (((unsigned long long) (_S_).st_mtim.tv_sec * 1000000000ULL)\
+	+ (unsigned long long) (_S_).st_mtim.tv_nsec)
+#endif
+
+/*
+ * Buffer strings
+ */
+static const std::string BUF_EXC_STR[] = {
+	"Failed to allocate buffer",
+};
+
+/*
+ * Buffer string lookup macros
+ */
+#define BUF_EXC_STRING(_T_) (_T_ > MAX_BUF_EXC_TYPE ? "Unknown buffer exception type" : BUF_EXC_STR[_T_])
+
+/*
+ * Buffer exception macros
+ */
+#define THROW_BUF_EXC(_T_) {\
+	std::stringstream ss;\
+	ss << BUF_EXC_STRING(_T_);\
+	throw std::runtime_error(ss.str().c_str());\
+	}
+	
+#define THROW_BUF_EXC_W_MESS(_M_, _T_) {\
+	std::stringstream ss;\
+	ss << BUF_EXC_STRING(_T_) << ": " << _M_;\
+	throw std::runtime_error(ss.str().c_str());\
+	}
+
+#endif
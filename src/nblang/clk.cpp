@@ -0,0 +1,54 @@
+/*
+ * clk.cpp
+ * Copyright (C) 2013 David Jolly
+ * ----------------------
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "clk.h"
+
+#ifndef _WIN32
+#include <time.h>
+#else
+#include <windows.h>
+#endif
+
+_clk::_clk(void)
+{
+	return;
+}
+
+unsigned long long 
+_clk::now(void)
+{
+#ifndef _WIN32
+	struct timespec now;
+
+	clock_gettime(CLOCK_MONOTONIC, &now);
+
+	return (now.tv_sec * CLK_NSEC_PER_SEC) + now.tv_nsec;
+#else
+	LARGE_INTEGER count;
+	static LARGE_INTEGER frequency = {0};
+
+	if(!frequency.QuadPart) {
+		QueryPerformanceFrequency(&frequency);
+	}
+	QueryPerformanceCounter(&count);
+
+	return (unsigned long long) ((count.QuadPart / frequency.QuadPart) * CLK_NSEC_PER_SEC)
+		+ (unsigned long long) (((count.QuadPart % frequency.QuadPart) * CLK_NSEC_PER_SEC) / frequency.QuadPart);
+#endif
+}
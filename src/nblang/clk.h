@@ -0,0 +1,50 @@
+/*
+ * clk.h
+ * Copyright (C) 2013 David Jolly
+ * ----------------------
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef CLK_H_
+#define CLK_H_
+
+#include "clk_type.h"
+
+/*
+ * Clock class
+ * (monotonic, high-resolution time source shared by the profiler,
+ * tracer and benchmarks)
+ */
+typedef class _clk {
+
+	public:
+
+		/*
+		 * Retrieve a monotonic timestamp
+		 * @return timestamp in nanoseconds
+		 */
+		static unsigned long long now(void);
+
+	protected:
+
+		/*
+		 * Clock constructor
+		 * (the clock is only accessed through static routines)
+		 */
+		_clk(void);
+
+} clk, *clk_ptr;
+
+#endif
@@ -0,0 +1,31 @@
+/*
+ * clk_type.h
+ * Copyright (C) 2013 David Jolly
+ * ----------------------
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef CLK_TYPE_H_
+#define CLK_TYPE_H_
+
+class _clk;
+typedef _clk clk, *clk_ptr;
+
+/*
+ * Clock units
+ */
+#define CLK_NSEC_PER_SEC 1000000000ULL
+
+#endif
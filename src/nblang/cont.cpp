@@ -58,16 +58,28 @@ _cont::clear(void)
 	_values.clear();
 }
 
+tok_stmt_vector_ptr 
+_cont::find_value(
+	size_t key
+	)
+{
+	std::map<size_t, tok_stmt_vector>::iterator entry = _values.find(key);
+
+	return (entry != _values.end()) ? &entry->second : NULL;
+}
+
 tok_stmt_vector &
 _cont::get_value(
-	const std::string &key
+	size_t key
 	)
 {
-	if(_values.find(key) == _values.end()) {
-		THROW_CONT_EXC_W_MESS(key, CONT_EXC_INVALID_KEY);
+	std::map<size_t, tok_stmt_vector>::iterator entry = _values.find(key);
+
+	if(entry == _values.end()) {
+		THROW_CONT_EXC_W_MESS(atm::get_text(key), CONT_EXC_INVALID_KEY);
 	}
 
-	return _values.find(key)->second;
+	return entry->second;
 }
 
 size_t 
@@ -76,9 +88,15 @@ _cont::get_value_count(void)
 	return _values.size();
 }
 
+const std::map<size_t, tok_stmt_vector> &
+_cont::get_values(void) const
+{
+	return _values;
+}
+
 bool 
 _cont::has_value(
-	const std::string &key
+	size_t key
 	)
 {
 	return _values.find(key) != _values.end();
@@ -86,20 +104,20 @@ _cont::has_value(
 
 void 
 _cont::remove_value(
-	const std::string &key
+	size_t key
 	)
 {
-	std::map<std::string, tok_stmt_vector>::iterator entry = _values.find(key);
+	std::map<size_t, tok_stmt_vector>::iterator entry = _values.find(key);
 
 	if(entry == _values.end()) {
-		THROW_CONT_EXC_W_MESS(key, CONT_EXC_INVALID_KEY);
+		THROW_CONT_EXC_W_MESS(atm::get_text(key), CONT_EXC_INVALID_KEY);
 	}
 	_values.erase(entry);
 }
 
 void 
 _cont::set_value(
-	const std::string &key,
+	size_t key,
 	const tok_stmt &value
 	)
 {
@@ -108,42 +126,45 @@ _cont::set_value(
 
 void 
 _cont::set_value(
-	const std::string &key,
+	size_t key,
 	const tok_stmt &value,
 	size_t index
 	)
 {
 	tok_stmt_vector value_list;
+	std::map<size_t, tok_stmt_vector>::iterator entry = _values.find(key);
 
-	if(_values.find(key) == _values.end()) {
+	if(entry == _values.end()) {
 
 		if(index) {
-			THROW_CONT_EXC_W_MESS(key << "[" << index << "]", CONT_EXC_INVALID_INDEX);
+			THROW_CONT_EXC_W_MESS(atm::get_text(key) << "[" << index << "]", CONT_EXC_INVALID_INDEX);
 		}
 		value_list.push_back(value);
-		_values.insert(std::pair<std::string, tok_stmt_vector>(key, value_list));
+		_values.insert(std::pair<size_t, tok_stmt_vector>(key, value_list));
 	} else {
 
-		if(index < _values.at(key).size()) {
-			_values.at(key).at(index) = value;
-		} else if(index == _values.at(key).size()) {
-			_values.at(key).push_back(value);
+		if(index < entry->second.size()) {
+			entry->second.at(index) = value;
+		} else if(index == entry->second.size()) {
+			entry->second.push_back(value);
 		} else {
-			THROW_CONT_EXC_W_MESS(key << "[" << index << "]", CONT_EXC_INVALID_INDEX);
+			THROW_CONT_EXC_W_MESS(atm::get_text(key) << "[" << index << "]", CONT_EXC_INVALID_INDEX);
 		}
 	}
 }
 
 void 
 _cont::set_value(
-	const std::string &key,
+	size_t key,
 	const tok_stmt_vector &value
 	)
 {
-	if(_values.find(key) == _values.end()) {
-		_values.insert(std::pair<std::string, tok_stmt_vector>(key, value));
+	std::map<size_t, tok_stmt_vector>::iterator entry = _values.find(key);
+
+	if(entry == _values.end()) {
+		_values.insert(std::pair<size_t, tok_stmt_vector>(key, value));
 	} else {
-		_values.at(key) = value;
+		entry->second = value;
 	}
 }
 
@@ -154,10 +175,10 @@ _cont::to_string(
 {
 	std::stringstream ss;
 	tok_stmt_vector::iterator child;
-	std::map<std::string, tok_stmt_vector>::iterator entry = _values.begin();
+	std::map<size_t, tok_stmt_vector>::iterator entry = _values.begin();
 
 	if(!_values.empty()) {
-		ss << entry->first << " (" << entry->second.size() << ")\t-->\n";
+		ss << atm::get_text(entry->first) << " (" << entry->second.size() << ")\t-->\n";
 
 		for(; entry != _values.end(); ++entry) {
 
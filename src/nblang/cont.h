@@ -74,12 +74,21 @@ typedef class _cont {
 		void clear(void);
 
 		/*
-		 * Retrieve context value at a given key string
-		 * @param key key string reference
+		 * Find context value at a given key atom
+		 * @param key key atom id
+		 * @return context value pointer, or NULL if the key does not exist
+		 */
+		tok_stmt_vector_ptr find_value(
+			size_t key
+			);
+
+		/*
+		 * Retrieve context value at a given key atom
+		 * @param key key atom id
 		 * @return context value at a given key
 		 */
 		tok_stmt_vector &get_value(
-			const std::string &key
+			size_t key
 			);
 
 		/*
@@ -88,51 +97,58 @@ typedef class _cont {
 		 */
 		size_t get_value_count(void);
 
+		/*
+		 * Retrieve context values
+		 * @return context values, keyed by atom id
+		 */
+		const std::map<size_t, tok_stmt_vector> &get_values(void) const;
+
 		/*
 		 * Retrieve context value status
+		 * @param key key atom id
 		 * @return true if not empty, false otherwise
 		 */
 		bool has_value(
-			const std::string &key
+			size_t key
 			);
 
 		/*
-		 * Remove value at a given key string
-		 * @param key key string reference
+		 * Remove value at a given key atom
+		 * @param key key atom id
 		 */
 		void remove_value(
-			const std::string &key
+			size_t key
 			);
 
 		/*
-		 * Set value at a given key string
-		 * @param key key string reference
+		 * Set value at a given key atom
+		 * @param key key atom id
 		 * @param value value object reference
 		 */
 		void set_value(
-			const std::string &key,
+			size_t key,
 			const tok_stmt &value
 			);
 
 		/*
-		 * Set value at a given key string with a given index
-		 * @param key key string reference
+		 * Set value at a given key atom with a given index
+		 * @param key key atom id
 		 * @param value value object reference
 		 * @param index value index
 		 */
 		void set_value(
-			const std::string &key,
+			size_t key,
 			const tok_stmt &value,
 			size_t index
 			);
 
 		/*
-		 * Set value at a given key string
-		 * @param key key string reference
+		 * Set value at a given key atom
+		 * @param key key atom id
 		 * @param value value object reference
 		 */
 		void set_value(
-			const std::string &key,
+			size_t key,
 			const tok_stmt_vector &value
 			);
 
@@ -147,7 +163,7 @@ typedef class _cont {
 
 	protected:
 
-		std::map<std::string, tok_stmt_vector> _values;
+		std::map<size_t, tok_stmt_vector> _values;
 
 } cont, *cont_ptr;
 
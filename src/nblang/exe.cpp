@@ -20,18 +20,98 @@
 #include <queue>
 #include <sstream>
 #include <stdexcept>
+#include "clk.h"
 #include "exe.h"
+#include "exe_ext.h"
 #include "lang.h"
 
 //#define EXECUTOR_TRACING
 #ifndef EXECUTOR_TRACING
-#define TRACE_EVENT(_M_, _T_)
+#define TRACE_SUBSYSTEM TRC_SUBSYSTEM_EXECUTOR
+#include "trace.h"
 #else
 #define TRACE_HEADER "executor"
 #include "trace.h"
 #endif
 
-_exe::_exe(void)
+/*
+ * Executor value stack accessor
+ * (std::stack keeps its underlying container protected)
+ */
+typedef struct _exe_stack_access : public tok_stack {
+
+	static const tok_stack::container_type &get(
+		const tok_stack &stack
+		)
+	{
+		return stack.*&_exe_stack_access::c;
+	}
+
+} exe_stack_access;
+
+/*
+ * Retrieve the container underlying a value stack
+ * @param stack value stack reference
+ * @return value stack container reference
+ */
+static const tok_stack::container_type &
+exe_stack_container(
+	const tok_stack &stack
+	)
+{
+	return exe_stack_access::get(stack);
+}
+
+/*
+ * Estimate the bytes held by a value list
+ * @param value value list reference
+ * @return estimated byte count
+ */
+static size_t 
+exe_value_size(
+	const tok_stmt_vector &value
+	)
+{
+	size_t i = 0, result = value.capacity() * sizeof(tok_stmt);
+
+	for(; i < value.size(); ++i) {
+		result += exe_node_size(value.at(i).get_root_node());
+	}
+
+	return result;
+}
+
+/*
+ * Estimate the bytes held by a given scope node and its children
+ * @param node scope node pointer
+ * @return estimated byte count
+ */
+static size_t 
+exe_scope_size(
+	const cont_node *node
+	)
+{
+	size_t i = 0, result = 0;
+	std::map<size_t, tok_stmt_vector>::const_iterator entry;
+
+	if(node) {
+		result = sizeof(cont_node);
+
+		for(entry = node->get().get_values().begin(); entry != node->get().get_values().end(); ++entry) {
+			result += sizeof(*entry) + exe_value_size(entry->second);
+		}
+
+		for(; i < node->get_child_count(); ++i) {
+			result += exe_scope_size(node->get_child(i));
+		}
+	}
+
+	return result;
+}
+
+_exe::_exe(void) :
+	_clock_start(clk::now()),
+	_memory_program_count(0)
 {
 	TRACE_EVENT("+_exe::_exe", TRACE_TYPE_INFORMATION);
 
@@ -46,6 +126,12 @@ _exe::_exe(
 	) :
 		_scope(other._scope),
 		_stack(other._stack),
+		_profiler(other._profiler),
+		_memory(other._memory),
+		_budget(other._budget),
+		_clock_start(other._clock_start),
+		_memory_program_count(other._memory_program_count),
+		_statistics(other._statistics),
 		_arguments(other._arguments)
 {
 	TRACE_EVENT("+_exe::_exe", TRACE_TYPE_INFORMATION);
@@ -73,6 +159,12 @@ _exe::operator=(
 	if(this != &other) {
 		_scope = other._scope;
 		_stack = other._stack;
+		_profiler = other._profiler;
+		_memory = other._memory;
+		_budget = other._budget;
+		_clock_start = other._clock_start;
+		_memory_program_count = other._memory_program_count;
+		_statistics = other._statistics;
 		_arguments = other._arguments;
 		memcpy(_actions, other._actions, sizeof(exe_action) * (MAX_EXE_ACTION_TYPE + 1));
 		memcpy(_eval_actions, other._eval_actions, sizeof(exe_eval_action) * (MAX_EXE_EVAL_ACTION_TYPE + 1));
@@ -144,23 +236,35 @@ _exe::clear_stack(void)
 	}
 }
 
-void 
+size_t 
 _exe::evaluate(void)
 {
 	TRACE_EVENT("+_exe::evaluate", TRACE_TYPE_INFORMATION);
 
+	size_t signal = EXE_SIG_NONE;
+
 	if(IS_CLASS_TYPE_T(par::get().get_root(), CLASS_TOKEN_TYPE_BEGIN)) {
 		par::move_next();
 	}
 
 	while(has_next()) {
 		
-		if(step() == EXE_SIG_EXIT) {
+		signal = step();
+
+		if(signal == EXE_SIG_EXIT
+				|| signal == EXE_SIG_ABORT) {
 			break;
 		}
 	}
 
+	if(_memory.is_enabled()) {
+		sample_memory();
+		_memory.test_limit();
+	}
+
 	TRACE_EVENT("-_exe::evaluate", TRACE_TYPE_INFORMATION);
+
+	return signal;
 }
 
 cont &
@@ -204,6 +308,38 @@ _exe::get_arguments(void)
 	return _arguments;
 }
 
+bud &
+_exe::get_budget(void)
+{
+	TRACE_EVENT("_exe::get_budget", TRACE_TYPE_VERBOSE);
+
+	return _budget;
+}
+
+unsigned long long 
+_exe::get_clock(void)
+{
+	TRACE_EVENT("_exe::get_clock", TRACE_TYPE_VERBOSE);
+
+	return clk::now() - _clock_start;
+}
+
+mem &
+_exe::get_memory(void)
+{
+	TRACE_EVENT("_exe::get_memory", TRACE_TYPE_VERBOSE);
+
+	return _memory;
+}
+
+prf &
+_exe::get_profiler(void)
+{
+	TRACE_EVENT("_exe::get_profiler", TRACE_TYPE_VERBOSE);
+
+	return _profiler;
+}
+
 tok_stack &
 _exe::get_stack(void)
 {
@@ -212,6 +348,22 @@ _exe::get_stack(void)
 	return _stack;
 }
 
+sta &
+_exe::get_statistics(void)
+{
+	TRACE_EVENT("_exe::get_statistics", TRACE_TYPE_VERBOSE);
+
+	return _statistics;
+}
+
+io &
+_exe::get_stream(void)
+{
+	TRACE_EVENT("_exe::get_stream", TRACE_TYPE_VERBOSE);
+
+	return _stream;
+}
+
 bool 
 _exe::has_next(void)
 {
@@ -259,17 +411,48 @@ _exe::reset(
 
 	if(clear_scope) {
 		_scope.clear();
+		_stream.clear();
+	} else {
+		_stream.flush();
 	}
 
 	while(!_stack.empty()) {
 		_stack.pop();
 	}
+	_memory_program_count = 0;
+	_budget.start();
 	_invoke_action(EXE_ACTION_CONFIG_PARSER);
 	par::reset();
 
 	TRACE_EVENT("-_exe::reset", TRACE_TYPE_INFORMATION);
 }
 
+void 
+_exe::sample_memory(void)
+{
+	TRACE_EVENT("+_exe::sample_memory", TRACE_TYPE_VERBOSE);
+
+	size_t i = 0, result = 0;
+	const tok_stack::container_type &stack = exe_stack_container(_stack);
+
+	if(_statements.get_link_count() != _memory_program_count) {
+		_memory_program_count = _statements.get_link_count();
+
+		for(; i < _memory_program_count; ++i) {
+			result += exe_node_size(_statements.get(i).get_root_node());
+		}
+		_memory.set(MEM_REGION_PROGRAM, result);
+	}
+	_memory.set(MEM_REGION_SCOPE, exe_scope_size(_scope.get_root_node()));
+
+	for(i = 0, result = 0; i < stack.size(); ++i) {
+		result += exe_value_size(stack.at(i));
+	}
+	_memory.set(MEM_REGION_STACK, result);
+
+	TRACE_EVENT("-_exe::sample_memory", TRACE_TYPE_VERBOSE);
+}
+
 void 
 _exe::set_action(
 	exe_action action,
@@ -318,7 +501,25 @@ _exe::step(void)
 	}
 
 	if(has_next()) {
-		signal = _invoke_evaluation_action(EXE_EVAL_ACTION_STATEMENT);
+
+		try {
+			signal = _invoke_evaluation_action(EXE_EVAL_ACTION_STATEMENT);
+		} catch(std::runtime_error &exc) {
+			UNREF_PARAM(exc);
+			_profiler.unwind();
+			_stream.flush();
+
+			if(!_budget.is_exhausted()) {
+				throw;
+			}
+			TRACE_EVENT("Executor aborted: " << exc.what(), TRACE_TYPE_WARNING);
+			signal = EXE_SIG_ABORT;
+		}
+
+		if(signal == EXE_SIG_EXIT
+				|| !has_next()) {
+			_stream.flush();
+		}
 	} else {
 		TRACE_EVENT("Executor has no next statement to step to!", TRACE_TYPE_ERROR);
 		THROW_EXE_EXC(EXE_EXC_NO_NEXT_STATEMENT);
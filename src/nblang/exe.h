@@ -21,8 +21,13 @@
 #define EXE_H_
 
 #include <vector>
+#include "bud.h"
 #include "exe_type.h"
+#include "io.h"
+#include "mem.h"
 #include "par.h"
+#include "prf.h"
+#include "sta.h"
 
 /*
  * Executor class
@@ -66,8 +71,10 @@ typedef class _exe :
 
 		/*
 		 * Evaluate all statements
+		 * @return last evaluation signal (abort if the budget was
+		 * exhausted)
 		 */
-		void evaluate(void);
+		size_t evaluate(void);
 
 		/*
 		 * Retrieve current executor context
@@ -96,12 +103,48 @@ typedef class _exe :
 		 */
 		tok_vector &get_arguments(void);
 
+		/*
+		 * Retrieve execution budget
+		 * @return budget object reference
+		 */
+		bud &get_budget(void);
+
+		/*
+		 * Retrieve monotonic time elapsed since the executor was created
+		 * @return elapsed time in nanoseconds
+		 */
+		unsigned long long get_clock(void);
+
+		/*
+		 * Retrieve memory accounting
+		 * @return memory accounting object reference
+		 */
+		mem &get_memory(void);
+
+		/*
+		 * Retrieve statement profiler
+		 * @return profiler object reference
+		 */
+		prf &get_profiler(void);
+
 		/*
 		 * Retrieve stack
 		 * @return stack object reference
 		 */
 		tok_stack &get_stack(void);
 
+		/*
+		 * Retrieve execution statistics
+		 * @return statistics object reference
+		 */
+		sta &get_statistics(void);
+
+		/*
+		 * Retrieve io stream handler
+		 * @return io object reference
+		 */
+		io &get_stream(void);
+
 		/*
 		 * Retrieve next statement status
 		 * @return true if has next statement, false otherwise
@@ -142,6 +185,13 @@ typedef class _exe :
 			bool clear_scope
 			);
 
+		/*
+		 * Measure memory regions, updating accounting
+		 * (the caller tests the limit; the parsed program is only
+		 * remeasured when its statement count changes)
+		 */
+		void sample_memory(void);
+
 		/*
 		 * Set executor action type
 		 * @param action action callback
@@ -189,6 +239,43 @@ typedef class _exe :
 		 */
 		tok_stack _stack;
 
+		/*
+		 * Evaluation io stream handler
+		 */
+		io _stream;
+
+		/*
+		 * Evaluation statement profiler
+		 */
+		prf _profiler;
+
+		/*
+		 * Executor memory accounting
+		 */
+		mem _memory;
+
+		/*
+		 * Executor execution budget
+		 */
+		bud _budget;
+
+		/*
+		 * Executor clock origin, in nanoseconds
+		 * (fixed for the executor lifetime, so clock values kept in scope
+		 * stay comparable across initializations)
+		 */
+		unsigned long long _clock_start;
+
+		/*
+		 * Statement count at the last parsed program measurement
+		 */
+		size_t _memory_program_count;
+
+		/*
+		 * Evaluation statistics
+		 */
+		sta _statistics;
+
 		/*
 		 * Input arguments
 		 */
@@ -18,17 +18,20 @@
  */
 
 #include <fstream>
+#include <iomanip>
 #include <iostream>
 #include <sstream>
 #include <stdexcept>
 #include "exe.h"
 #include "exe_ext.h"
 #include "exe_ext_type.h"
+#include "hpf.h"
 #include "par_ext.h"
 
 //#define EXECUTOR_EXT_TRACING
 #ifndef EXECUTOR_EXT_TRACING
-#define TRACE_EVENT(_M_, _T_)
+#define TRACE_SUBSYSTEM TRC_SUBSYSTEM_EXECUTOR
+#include "trace.h"
 #else
 #define TRACE_HEADER "executor_ext"
 #include "trace.h"
@@ -37,12 +40,180 @@
 /*
  * Executor extension arguments
  */
-static tok_vector exe_args;
+static EXE_THREAD_LOCAL const tok_vector *exe_args = NULL;
 
 /* 
  * Executor extension parser
  */
-static par_ptr exe_par;
+static EXE_THREAD_LOCAL par_ptr exe_par = NULL;
+
+/*
+ * Executor extension io stream handler
+ */
+static EXE_THREAD_LOCAL io_ptr exe_io = NULL;
+
+/*
+ * Executor extension statement profiler
+ */
+static EXE_THREAD_LOCAL prf_ptr exe_prf = NULL;
+
+/*
+ * Executor extension statistics
+ */
+static EXE_THREAD_LOCAL sta_ptr exe_sta = NULL;
+
+/*
+ * Executor extension execution budget
+ */
+static EXE_THREAD_LOCAL bud_ptr exe_bud = NULL;
+
+/*
+ * Executor extension executor, sampled for memory accounting
+ */
+static EXE_THREAD_LOCAL exe_ptr exe_exe = NULL;
+
+/*
+ * Add a copied value to the executor statistics
+ * @param value copied value reference
+ */
+static void 
+exe_sta_add_copy(
+	const tok_stmt &value
+	)
+{
+
+	if(exe_sta
+			&& exe_sta->is_enabled()) {
+		exe_sta->add(STA_COUNTER_COPIED, 1);
+		exe_sta->add(STA_COUNTER_ALLOCATED, exe_node_size(value.get_root_node()));
+	}
+}
+
+/*
+ * Add copied values to the executor statistics
+ * @param value copied value list reference
+ */
+static void 
+exe_sta_add_copy(
+	const tok_stmt_vector &value
+	)
+{
+	size_t i = 0;
+
+	for(; i < value.size(); ++i) {
+		exe_sta_add_copy(value.at(i));
+	}
+}
+
+/*
+ * Add to an executor statistics counter
+ * @param type counter type
+ */
+static void 
+exe_sta_add(
+	size_t type
+	)
+{
+
+	if(exe_sta
+			&& exe_sta->is_enabled()) {
+		exe_sta->add(type, 1);
+	}
+}
+
+/*
+ * Add files opened by the executor io since a given open count
+ * (cached file and reader handles are reused without an open)
+ * @param count io open count before the operation
+ */
+static void 
+exe_sta_add_file_open(
+	size_t count
+	)
+{
+
+	if(exe_sta
+			&& exe_sta->is_enabled()
+			&& (exe_io->get_open_count() > count)) {
+		exe_sta->add(STA_COUNTER_FILE_OPEN, exe_io->get_open_count() - count);
+	}
+}
+
+/*
+ * Test the executor budget, throwing once it is exhausted
+ * (called at loop back-edges and function calls)
+ */
+static void 
+exe_bud_check(void)
+{
+
+	if(exe_bud
+			&& exe_bud->is_enabled()) {
+		exe_bud->check();
+	}
+}
+
+/*
+ * Set a token to a clock value, formatted in whole nanoseconds
+ * @param token token object reference
+ * @param value clock value, in nanoseconds
+ */
+static void 
+exe_set_clock_value(
+	tok &token,
+	double value
+	)
+{
+	std::stringstream ss;
+
+	ss << std::fixed << std::setprecision(0) << value;
+	EXE_SET_TOKEN_TYPE(token, TOKEN_TYPE_FLOAT, ss.str());
+}
+
+/*
+ * Add an empty scope to the back of the current context node's children
+ * @param context context tree object reference
+ */
+static void 
+exe_cont_add_scope(
+	cont_tree &context
+	)
+{
+	HPF_OWNER(HPF_OWNER_SCOPE);
+
+	context.add_child_back(cont());
+	exe_sta_add(STA_COUNTER_SCOPE);
+}
+
+/*
+ * Copy a function schema out of the context
+ * @param statement call statement object reference
+ * @param context context tree object reference
+ * @param id function identifier
+ * @param index function schema index
+ * @param schema function schema object reference
+ */
+static void 
+exe_cont_get_function(
+	tok_stmt &statement,
+	cont_tree &context,
+	size_t id,
+	size_t index,
+	tok_stmt &schema
+	)
+{
+	HPF_OWNER(HPF_OWNER_FUNCTION_COPY);
+
+	tok_stmt_vector funct_schema_vec = exe_cont_get_value(id, context, false);
+
+	exe_sta_add_copy(funct_schema_vec);
+
+	if(index >= funct_schema_vec.size()) {
+		TRACE_EVENT("Attempting to reference non-existent index: " << index, TRACE_TYPE_ERROR);
+		THROW_EXE_EXT_EXC_W_MESS(statement.get().get_text() << "[" << index << "]", EXE_EXT_EXC_REF_TO_NON_EXISTENT_INDEX);
+	}
+	schema = funct_schema_vec.at(index);
+}
 
 void 
 exe_advance_parser(
@@ -96,7 +267,7 @@ exe_config_parser(
 
 tok_stmt_vector 
 exe_cont_get_value(
-	const std::string &key,
+	size_t key,
 	cont_tree &context,
 	bool force_global
 	)
@@ -106,7 +277,7 @@ exe_cont_get_value(
 
 tok_stmt_vector_ptr
 exe_cont_get_value(
-	const std::string &key,
+	size_t key,
 	cont_node *context,
 	bool force_global,
 	bool root
@@ -126,17 +297,18 @@ exe_cont_get_value(
 		result = exe_cont_get_value(key, context->get_parent(), false, false);
 	} else {
 
-		if(context->get().has_value(key)) {
-			result = &context->get().get_value(key);
-		} else if(context->has_parent()) {
+		result = context->get().find_value(key);
+
+		if(!result
+				&& context->has_parent()) {
 			result = exe_cont_get_value(key, context->get_parent(), false, false);
 		}
 	}
 
 	if(root
 			&& !result) {
-		TRACE_EVENT("Key does not exist in this context: " << key, TRACE_TYPE_ERROR);
-		THROW_EXE_EXT_EXC_W_MESS(key, EXE_EXT_EXC_KEY_NOT_FOUND);
+		TRACE_EVENT("Key does not exist in this context: " << atm::get_text(key), TRACE_TYPE_ERROR);
+		THROW_EXE_EXT_EXC_W_MESS(atm::get_text(key), EXE_EXT_EXC_KEY_NOT_FOUND);
 	}
 
 	TRACE_EVENT("-exe_cont_get_value", TRACE_TYPE_VERBOSE);
@@ -146,7 +318,7 @@ exe_cont_get_value(
 
 bool 
 exe_cont_has_value(
-	const std::string &key,
+	size_t key,
 	cont_tree &context,
 	bool force_global
 	)
@@ -156,7 +328,7 @@ exe_cont_has_value(
 
 bool 
 exe_cont_has_value(
-	const std::string &key,
+	size_t key,
 	cont_node *context,
 	bool force_global
 	)
@@ -189,19 +361,22 @@ exe_cont_has_value(
 
 void 
 exe_cont_set_value(
-	const std::string &key,
+	size_t key,
 	const tok_stmt &value,
 	cont_tree &context,
 	size_t index,
 	bool force_global
 	)
 {
+	HPF_OWNER(HPF_OWNER_SCOPE);
+
+	exe_sta_add_copy(value);
 	exe_cont_set_value(key, value, context.get_position_node(), index, force_global, true);
 }
 
 bool 
 exe_cont_set_value(
-	const std::string &key,
+	size_t key,
 	const tok_stmt &value,
 	cont_node *context,
 	size_t index,
@@ -243,18 +418,21 @@ exe_cont_set_value(
 
 void 
 exe_cont_set_value(
-	const std::string &key,
+	size_t key,
 	const tok_stmt_vector &value,
 	cont_tree &context,
 	bool force_global
 	)
 {
+	HPF_OWNER(HPF_OWNER_SCOPE);
+
+	exe_sta_add_copy(value);
 	exe_cont_set_value(key, value, context.get_position_node(), force_global, true);
 }
 
 bool 
 exe_cont_set_value(
-	const std::string &key,
+	size_t key,
 	const tok_stmt_vector &value,
 	cont_node *context,
 	bool force_global,
@@ -293,6 +471,25 @@ exe_cont_set_value(
 	return result;
 }
 
+void 
+exe_create_segment_list(
+	tok_part_vector &parts,
+	std::vector<io_segment> &segments
+	)
+{
+	TRACE_EVENT("+exe_create_segment_list", TRACE_TYPE_VERBOSE);
+
+	size_t i = 0;
+
+	segments.resize(parts.size());
+
+	for(; i < parts.size(); ++i) {
+		segments.at(i).data = parts.at(i).front().get().get_text_data(segments.at(i).length);
+	}
+
+	TRACE_EVENT("-exe_create_segment_list", TRACE_TYPE_VERBOSE);
+}
+
 tok_stmt_vector 
 exe_create_statement_list(
 	const tok &token
@@ -317,6 +514,114 @@ exe_create_statement_list(
 	return result;
 }
 
+bool 
+exe_has_side_effect(
+	const tok_node *node
+	)
+{
+	TRACE_EVENT("+exe_has_side_effect", TRACE_TYPE_VERBOSE);
+
+	size_t i = 0;
+	bool result = false;
+
+	switch(node->get().get_type()) {
+		case TOKEN_TYPE_IDENTIFIER:
+			result = (node->has_children()
+				&& IS_CLASS_TYPE_T(node->get_child(IDENTIFIER_TYPE_CHILD)->get(), CLASS_TOKEN_TYPE_FUNCTION_PARAMETER_LIST));
+			break;
+		case TOKEN_TYPE_ITERATOR_OPERATOR:
+		case TOKEN_TYPE_OUT_LIST_OPERATOR:
+			result = true;
+			break;
+	}
+
+	for(; !result && i < node->get_child_count(); ++i) {
+		result = exe_has_side_effect(node->get_child(i));
+	}
+
+	TRACE_EVENT("-exe_has_side_effect", TRACE_TYPE_VERBOSE);
+
+	return result;
+}
+
+bool 
+exe_eval_append(
+	tok_stmt &statement,
+	cont_tree &context,
+	tok_stack &stack,
+	size_t key
+	)
+{
+	TRACE_EVENT("+exe_eval_append", TRACE_TYPE_INFORMATION);
+
+	const char *data = NULL;
+	size_t i = 1, length;
+	bool result = false;
+	tok_part_vector parts;
+	tok_stmt_vector_ptr value = NULL;
+
+	if(!IS_CLASS_TYPE_T(statement.get(), CLASS_TOKEN_TYPE_EXPRESSION)) {
+		TRACE_EVENT("Invalid expression class token: " << statement.get().to_string(true), TRACE_TYPE_ERROR);
+		THROW_EXE_EXT_EXC_W_MESS(statement.get().to_string(true), EXE_EXT_EXC_INVAL_EXPRESSION_CLASS_TOKEN);
+	}
+
+	if(statement.get_child_count() == MIN_CHILD_COUNT
+			&& IS_CLASS_TYPE_T(statement.get_child(0), CLASS_TOKEN_TYPE_EXPRESSION)) {
+		statement.move_child_front();
+		result = exe_eval_append(statement, context, stack, key);
+		statement.move_parent();
+
+		TRACE_EVENT("-exe_eval_append", TRACE_TYPE_INFORMATION);
+
+		return result;
+	}
+
+	result = (statement.get_child_count() > MIN_CHILD_COUNT
+		&& IS_TYPE_T(statement.get_child(0), TOKEN_TYPE_IDENTIFIER)
+		&& !statement.get_child_node(0)->has_children()
+		&& statement.get_child(0).get_atom() == key);
+
+	for(; result && i < statement.get_child_count(); ++i) {
+		result = (IS_TOKEN_TYPE_T(statement.get_child(i), TOKEN_TYPE_SYMBOL, SYMBOL_TYPE_ARITHMETIC_ADD)
+			&& !exe_has_side_effect(statement.get_child_node(i)));
+	}
+
+	if(result) {
+		value = exe_cont_get_value(key, context.get_position_node(), false, false);
+		result = (value
+			&& value->size() == MIN_CHILD_COUNT
+			&& IS_TYPE_T(value->front().get(), TOKEN_TYPE_VAR_STRING));
+	}
+
+	if(result) {
+
+		for(i = 1; i < statement.get_child_count(); ++i) {
+			statement.move_child(i);
+			statement.move_child_front();
+			exe_eval_expression_parts_helper(statement, context, stack, parts);
+			statement.move_parent();
+			statement.move_parent();
+		}
+
+		for(i = 0; result && i < parts.size(); ++i) {
+			result = (parts.at(i).size() == MIN_CHILD_COUNT);
+		}
+	}
+
+	if(result) {
+
+		for(i = 0; i < parts.size(); ++i) {
+			data = parts.at(i).front().get().get_text_data(length);
+			value->front().get().append(data, length);
+		}
+		exe_sta_add_copy(value->front());
+	}
+
+	TRACE_EVENT("-exe_eval_append", TRACE_TYPE_INFORMATION);
+
+	return result;
+}
+
 void 
 exe_eval_assignment(
 	tok_stmt &statement,
@@ -326,17 +631,21 @@ exe_eval_assignment(
 {
 	TRACE_EVENT("+exe_eval_assignment", TRACE_TYPE_INFORMATION);
 
-	bool index_ref, single_assign = false;
+	bool appended = false, index_ref, single_assign = false;
 	size_t ident_position = 0, expr_position = 0, offset = 0;
+	size_t key = ATM_INVALID_ID, depth;
 
 	if(!IS_TYPE_T(statement.get(), TOKEN_TYPE_ASSIGNMENT)) {
-		TRACE_EVENT("Invalid assignment token: " << statement.get()to_string(true), TRACE_TYPE_ERROR);
+		TRACE_EVENT("Invalid assignment token: " << statement.get().to_string(true), TRACE_TYPE_ERROR);
 		THROW_EXE_EXT_EXC_W_MESS(statement.get().to_string(true), EXE_EXT_EXC_INVAL_ASSIGNMENT_TOKEN);
 	}
 	index_ref = (statement.get_child_count() == ASSIGNMENT_MAX_CHILD_COUNT);
-	statement.move_child_front();
-	ident_position = statement.get_child_count();
-	statement.move_parent();
+	ident_position = statement.get_child_node(0)->get_child_count();
+
+	if(!index_ref
+			&& ident_position == MIN_CHILD_COUNT) {
+		key = statement.get_child_node(0)->get_child(0)->get().get_atom();
+	}
 
 	if(index_ref) {
 		statement.move_child(ASSIGNMENT_INDEX_CHILD);
@@ -347,6 +656,7 @@ exe_eval_assignment(
 		statement.move_parent();
 		statement.move_parent();
 	}
+	depth = stack.size();
 	statement.move_child(index_ref ? (ASSIGNMENT_TYPE_CHILD + 1) : ASSIGNMENT_TYPE_CHILD);
 
 	switch(statement.get().get_class_type()) {
@@ -371,8 +681,15 @@ exe_eval_assignment(
 			break;
 		case CLASS_TOKEN_TYPE_SIMPLE_ASSIGNMENT:
 			statement.move_child_front();
-			exe_eval_expression(statement, context, stack);
-			single_assign = (stack.size() <= MIN_CHILD_COUNT);
+
+			if(key != ATM_INVALID_ID) {
+				appended = exe_eval_append(statement, context, stack, key);
+			}
+
+			if(!appended) {
+				exe_eval_expression(statement, context, stack);
+				single_assign = ((stack.size() - depth) <= MIN_CHILD_COUNT);
+			}
 			statement.move_parent();
 			break;
 	}
@@ -380,13 +697,13 @@ exe_eval_assignment(
 	statement.move_child_front();
 	--ident_position;
 
-	for(; (long) ident_position >= 0; --ident_position) {
+	for(; !appended && (long) ident_position >= 0; --ident_position) {
 		statement.move_child(ident_position);
 
 		if(index_ref) {
-			exe_cont_set_value(statement.get().get_text(), stack.top().front(), context, offset, false);
+			exe_cont_set_value(statement.get().get_atom(), stack.top().front(), context, offset, false);
 		} else {
-			exe_cont_set_value(statement.get().get_text(), stack.top(), context, false);
+			exe_cont_set_value(statement.get().get_atom(), stack.top(), context, false);
 		}
 
 		if(!single_assign
@@ -397,6 +714,10 @@ exe_eval_assignment(
 	}
 	statement.move_parent();
 
+	while(stack.size() > depth) {
+		stack.pop();
+	}
+
 	TRACE_EVENT("-exe_eval_assignment", TRACE_TYPE_INFORMATION);
 }
 
@@ -447,7 +768,7 @@ exe_eval_conditional(
 			if(exe_eval_conditional_statement_list(statement, context, stack, IF_COND_STMT_CHILD, COND_STMT_SEPERATOR_CHILD)) {
 				statement.move_parent();
 				statement.move_child(IF_COND_STMT_LIST_CHILD);
-				context.add_child_back(cont());
+				exe_cont_add_scope(context);
 				context.move_child_back();
 				signal = exe_eval_statement_list(statement, context, stack);
 				context.move_parent();
@@ -461,7 +782,7 @@ exe_eval_conditional(
 			if(exe_eval_conditional_statement_list(statement, context, stack, IFELSE_COND_STMT_CHILD, COND_STMT_SEPERATOR_CHILD)) {
 				statement.move_parent();
 				statement.move_child(IFELSE_COND_STMT0_LIST_CHILD);
-				context.add_child_back(cont());
+				exe_cont_add_scope(context);
 				context.move_child_back();
 				signal = exe_eval_statement_list(statement, context, stack);
 				context.move_parent();
@@ -469,7 +790,7 @@ exe_eval_conditional(
 			} else {
 				statement.move_parent();
 				statement.move_child(IFELSE_COND_STMT1_LIST_CHILD);
-				context.add_child_back(cont());
+				exe_cont_add_scope(context);
 				context.move_child_back();
 				signal = exe_eval_statement_list(statement, context, stack);
 				context.move_parent();
@@ -481,9 +802,10 @@ exe_eval_conditional(
 			statement.move_child(RANGE_COND_STMT_CHILD);
 
 			while(exe_eval_range_statement(statement, context, stack)) {
+				exe_bud_check();
 				statement.move_parent();
 				statement.move_child(RANGE_COND_STMT_LIST_CHILD);
-				context.add_child_back(cont());
+				exe_cont_add_scope(context);
 				context.move_child_back();
 				signal = exe_eval_statement_list(statement, context, stack);
 				context.move_parent();
@@ -517,9 +839,10 @@ exe_eval_conditional(
 			statement.move_child(WHILE_COND_STMT_CHILD);
 
 			while(exe_eval_conditional_statement_list(statement, context, stack, WHILE_COND_STMT_CHILD, COND_STMT_SEPERATOR_CHILD)) {
+				exe_bud_check();
 				statement.move_parent();
 				statement.move_child(WHILE_COND_STMT_LIST_CHILD);
-				context.add_child_back(cont());
+				exe_cont_add_scope(context);
 				context.move_child_back();
 				signal = exe_eval_statement_list(statement, context, stack);
 				context.move_parent();
@@ -543,9 +866,10 @@ exe_eval_conditional(
 			statement.move_child(UNTIL_COND_STMT_CHILD);
 
 			do {
+				exe_bud_check();
 				statement.move_parent();
 				statement.move_child(UNTIL_COND_STMT_LIST_CHILD);
-				context.add_child_back(cont());
+				exe_cont_add_scope(context);
 				context.move_child_back();
 				signal = exe_eval_statement_list(statement, context, stack);
 				context.move_parent();
@@ -583,20 +907,20 @@ exe_eval_conditional_statement(
 
 	bool result = false;
 	size_t comparator_type;
+	const tok_node *comparator = NULL;
 	tok_stmt left_operand, right_operand;
 	
 	if(!IS_CLASS_TYPE_T(statement.get(), CLASS_TOKEN_TYPE_CONDITIONAL_STATEMENT)) {
 		TRACE_EVENT("Invalid conditional statement token: " << statement.get().to_string(true), TRACE_TYPE_ERROR);
 		THROW_EXE_EXT_EXC_W_MESS(statement.get().to_string(true), EXE_EXT_EXC_INVAL_CONDITIONAL_STMT_TOKEN);
 	}
-	statement.move_child(COND_STMT_COMPARATOR_CHILD);
+	comparator = statement.get_child_node(COND_STMT_COMPARATOR_CHILD);
 
-	if(!IS_TYPE_T(statement.get(), TOKEN_TYPE_COMPARATOR)) {
-		TRACE_EVENT("Invalid comparator token: " << statement.get().to_string(true), TRACE_TYPE_ERROR);
-		THROW_EXE_EXT_EXC_W_MESS(statement.get().to_string(true), EXE_EXT_EXC_INVAL_COMPARATOR_TOKEN);
+	if(!IS_TYPE_T(comparator->get(), TOKEN_TYPE_COMPARATOR)) {
+		TRACE_EVENT("Invalid comparator token: " << comparator->get().to_string(true), TRACE_TYPE_ERROR);
+		THROW_EXE_EXT_EXC_W_MESS(comparator->get().to_string(true), EXE_EXT_EXC_INVAL_COMPARATOR_TOKEN);
 	}
-	comparator_type = statement.get().get_subtype();
-	statement.move_parent();
+	comparator_type = comparator->get().get_subtype();
 	statement.move_child(COND_STMT_EXPRESSION_CHILD_0);
 	exe_eval_expression(statement, context, stack);
 	statement.move_parent();
@@ -664,10 +988,12 @@ exe_eval_conditional_statement_list(
 	TRACE_EVENT("+exe_eval_conditional_statement_list", TRACE_TYPE_INFORMATION);
 
 	bool result = false;
+	const tok_node *seperator_list = NULL;
 	size_t i = 0, type = CONDITIONAL_SEPERATOR_AND;
 
 	UNREF_PARAM(context);
 	UNREF_PARAM(stack);
+	UNREF_PARAM(cond_index);
 
 	if(!IS_CLASS_TYPE_T(statement.get(), CLASS_TOKEN_TYPE_CONDITIONAL_STATEMENT_LIST)) {
 		TRACE_EVENT("Invalid conditional statement list token: " << statement.get().to_string(true), TRACE_TYPE_ERROR);
@@ -677,13 +1003,11 @@ exe_eval_conditional_statement_list(
 	for(; i < statement.get_child_count(); ++i) {
 
 		if(i) {
-			statement.move_parent();
-			statement.move_child(sep_index);
-			statement.move_child(i - 1);
-			type = statement.get().get_subtype();
-			statement.move_parent();
-			statement.move_parent();
-			statement.move_child(cond_index);
+
+			if(!seperator_list) {
+				seperator_list = statement.get_position_node()->get_parent()->get_child(sep_index);
+			}
+			type = seperator_list->get_child(i - 1)->get().get_subtype();
 		}
 		statement.move_child(i);
 		result = !i ? exe_eval_conditional_statement(statement, context, stack) : 
@@ -743,6 +1067,7 @@ exe_eval_expression(
 {
 	TRACE_EVENT("+exe_eval_expression", TRACE_TYPE_INFORMATION);
 		
+	HPF_OWNER(HPF_OWNER_STACK);
 	tok_stack operator_stack;
 
 	if(!IS_CLASS_TYPE_T(statement.get(), CLASS_TOKEN_TYPE_EXPRESSION)) {
@@ -768,6 +1093,13 @@ extern void exe_eval_expression_helper(
 	tok_stmt_vector value_list;
 	tok value_tok, left_operand, right_operand;
 
+	exe_sta_add(STA_COUNTER_EXPRESSION);
+
+	if(exe_bud
+			&& exe_bud->is_enabled()) {
+		exe_bud->add_expression();
+	}
+
 	if(statement.has_children()) {
 
 		if(IS_CLASS_TYPE_T(statement.get(), CLASS_TOKEN_TYPE_EXPRESSION)) {
@@ -798,11 +1130,11 @@ extern void exe_eval_expression_helper(
 					statement.move_parent();
 					offset = stack.top().front().get().to_integer();
 					stack.pop();
-					if(offset >= exe_args.size()) {
+					if(offset >= exe_args->size()) {
 						TRACE_EVENT("Attempting to reference non-existent argument: " << offset, TRACE_TYPE_ERROR);
 						THROW_EXE_EXT_EXC_W_MESS(offset, EXE_EXT_EXC_REF_TO_NON_EXISTENT_ARG);
 					}
-					stack.push(exe_create_statement_list(exe_args.at(offset)));
+					stack.push(exe_create_statement_list(exe_args->at(offset)));
 					break;
 				case TOKEN_TYPE_CONVERSION_OPERATOR:
 					statement.move_child_front();
@@ -858,7 +1190,7 @@ extern void exe_eval_expression_helper(
 							statement.move_parent();
 							offset = stack.top().front().get().to_integer();
 							stack.pop();
-							value_list = exe_cont_get_value(statement.get().get_text(), context, false);
+							value_list = exe_cont_get_value(statement.get().get_atom(), context, false);
 
 							if(offset >= value_list.size()) {
 								TRACE_EVENT("Attempting to reference non-existent index: " << offset, TRACE_TYPE_ERROR);
@@ -869,7 +1201,7 @@ extern void exe_eval_expression_helper(
 					}
 					break;
 				case TOKEN_TYPE_IO_OPERATOR:
-					exe_eval_io(statement, context, stack);
+					exe_eval_io(statement, context, stack, true);
 					break;
 				case TOKEN_TYPE_LOGICAL_OPERATOR:
 					statement.move_child_front();
@@ -880,6 +1212,10 @@ extern void exe_eval_expression_helper(
 						case LOGICAL_OPERATOR_TYPE_CEILING:
 							stack.top().front().get().ceiling();
 							break;
+						case LOGICAL_OPERATOR_TYPE_ELAPSED:
+							exe_set_clock_value(stack.top().front().get(), (exe_exe ? (double) exe_exe->get_clock() : 0.0) 
+								- stack.top().front().get().to_float());
+							break;
 						case LOGICAL_OPERATOR_TYPE_FLOOR:
 							stack.top().front().get().floor();
 							break;
@@ -928,13 +1264,16 @@ extern void exe_eval_expression_helper(
 
 		switch(statement.get().get_type()) {
 			case TOKEN_TYPE_ARGUMENT:
-				ss << exe_args.size();
+				ss << exe_args->size();
 				EXE_SET_TOKEN_TYPE(value_tok, TOKEN_TYPE_INTEGER, ss.str());
 				stack.push(exe_create_statement_list(value_tok));
 				break;
 			case TOKEN_TYPE_CONSTANT:
 				
 				switch(statement.get().get_subtype()) {
+					case CONSTANT_TYPE_CLOCK:
+						exe_set_clock_value(value_tok, exe_exe ? (double) exe_exe->get_clock() : 0.0);
+						break;
 					case CONSTANT_TYPE_EMPTY:
 						EXE_SET_TOKEN_TYPE(value_tok, TOKEN_TYPE_VAR_STRING, std::string());
 					case CONSTANT_TYPE_ENDLINE:
@@ -961,7 +1300,7 @@ extern void exe_eval_expression_helper(
 				stack.push(exe_create_statement_list(statement.get()));
 				break;
 			case TOKEN_TYPE_IDENTIFIER:
-				stack.push(exe_cont_get_value(statement.get().get_text(), context, false));
+				stack.push(exe_cont_get_value(statement.get().get_atom(), context, false));
 				break;
 		}
 	}
@@ -969,6 +1308,91 @@ extern void exe_eval_expression_helper(
 	TRACE_EVENT("-exe_eval_expression_helper", TRACE_TYPE_VERBOSE);
 }
 
+void 
+exe_eval_expression_parts(
+	tok_stmt &statement,
+	cont_tree &context,
+	tok_stack &stack,
+	tok_part_vector &parts
+	)
+{
+	TRACE_EVENT("+exe_eval_expression_parts", TRACE_TYPE_INFORMATION);
+
+	HPF_OWNER(HPF_OWNER_STACK);
+
+	if(!IS_CLASS_TYPE_T(statement.get(), CLASS_TOKEN_TYPE_EXPRESSION)) {
+		TRACE_EVENT("Invalid expression class token: " << statement.get().to_string(true), TRACE_TYPE_ERROR);
+		THROW_EXE_EXT_EXC_W_MESS(statement.get().to_string(true), EXE_EXT_EXC_INVAL_EXPRESSION_CLASS_TOKEN);
+	}
+	parts.clear();
+	exe_eval_expression_parts_helper(statement, context, stack, parts);
+
+	TRACE_EVENT("-exe_eval_expression_parts", TRACE_TYPE_INFORMATION);
+}
+
+extern void exe_eval_expression_parts_helper(
+	tok_stmt &statement,
+	cont_tree &context,
+	tok_stack &stack,
+	tok_part_vector &parts
+	)
+{
+	TRACE_EVENT("+exe_eval_expression_parts_helper", TRACE_TYPE_VERBOSE);
+
+	size_t i = 1, first = parts.size();
+	tok_stack operator_stack;
+	bool is_concatenation = false;
+
+	if(IS_CLASS_TYPE_T(statement.get(), CLASS_TOKEN_TYPE_EXPRESSION)) {
+		is_concatenation = (statement.get_child_count() > MIN_CHILD_COUNT);
+
+		for(; is_concatenation && i < statement.get_child_count(); ++i) {
+			is_concatenation = IS_TOKEN_TYPE_T(statement.get_child(i), TOKEN_TYPE_SYMBOL, SYMBOL_TYPE_ARITHMETIC_ADD);
+		}
+
+		if(!is_concatenation
+				&& statement.get_child_count() == MIN_CHILD_COUNT
+				&& IS_CLASS_TYPE_T(statement.get_child(0), CLASS_TOKEN_TYPE_EXPRESSION)) {
+			statement.move_child_front();
+			exe_eval_expression_parts_helper(statement, context, stack, parts);
+			statement.move_parent();
+
+			TRACE_EVENT("-exe_eval_expression_parts_helper", TRACE_TYPE_VERBOSE);
+
+			return;
+		}
+	}
+
+	if(is_concatenation) {
+		statement.move_child_front();
+		exe_eval_expression_parts_helper(statement, context, stack, parts);
+		statement.move_parent();
+
+		for(i = 1; i < statement.get_child_count(); ++i) {
+			statement.move_child(i);
+			statement.move_child_front();
+			exe_eval_expression_parts_helper(statement, context, stack, parts);
+			statement.move_parent();
+
+			if(parts.size() == first + 2
+					&& IS_NUMERIC_OPERATION_T(parts.at(first).front().get(), parts.at(first + 1).front().get())) {
+				exe_eval_operation(stack, parts.at(first).front().get(), parts.at(first + 1).front().get(), statement.get());
+				parts.at(first).swap(stack.top());
+				stack.pop();
+				parts.pop_back();
+			}
+			statement.move_parent();
+		}
+	} else {
+		exe_eval_expression_helper(statement, context, stack, operator_stack);
+		parts.push_back(tok_stmt_vector());
+		parts.back().swap(stack.top());
+		stack.pop();
+	}
+
+	TRACE_EVENT("-exe_eval_expression_parts_helper", TRACE_TYPE_VERBOSE);
+}
+
 void 
 exe_eval_identifier_operator(
 	tok_stmt &statement,
@@ -988,7 +1412,7 @@ exe_eval_identifier_operator(
 	switch(statement.get().get_type()) {
 		case TOKEN_TYPE_ACCESS:
 			statement.move_child_front();
-			stack.push(exe_cont_get_value(statement.get().get_text(), context, true));
+			stack.push(exe_cont_get_value(statement.get().get_atom(), context, true));
 			statement.move_parent();
 			break;
 		case TOKEN_TYPE_ITERATOR_OPERATOR:
@@ -1028,16 +1452,16 @@ exe_eval_in_list(
 
 	for(; i < statement.get_child_count(); ++i) {
 		statement.move_child(i);
-		value_stmt_vec = exe_cont_get_value(statement.get().get_text(), context, false);
+		value_stmt_vec = exe_cont_get_value(statement.get().get_atom(), context, false);
 
 		switch(subtype) {
 			case IN_LIST_OPERATOR_TYPE_PUSH_END:
 				value_stmt_vec.push_back(stack.top().front());
-				exe_cont_set_value(statement.get().get_text(), value_stmt_vec, context, false);
+				exe_cont_set_value(statement.get().get_atom(), value_stmt_vec, context, false);
 				break;
 			case IN_LIST_OPERATOR_TYPE_PUSH_FRONT:
 				value_stmt_vec.insert(value_stmt_vec.begin(), stack.top().front());
-				exe_cont_set_value(statement.get().get_text(), value_stmt_vec, context, false);
+				exe_cont_set_value(statement.get().get_atom(), value_stmt_vec, context, false);
 				break;
 		}
 		stack.pop();
@@ -1052,16 +1476,24 @@ void
 exe_eval_io(
 	tok_stmt &statement,
 	cont_tree &context,
-	tok_stack &stack
+	tok_stack &stack,
+	bool to_stack
 	)
 {
 	TRACE_EVENT("+exe_eval_io", TRACE_TYPE_INFORMATION);
 
+	int status;
+	long count = -1;
 	tok input_tok;
-	std::stringstream ss;
-	size_t child_position = 0;
+	buf_ptr input_buf = NULL;
+	tok_part_vector parts;
+	tok_stmt_vector value_stmt_vec;
+	size_t child_position = 0, handle, open_count;
+	std::vector<io_segment> segments;
 	std::string input, filename;
-	bool is_append = false, is_binary = false, is_trunc = false;
+	const tok_node *option_list = NULL;
+	bool is_append = false, is_async = false, is_binary = false, is_capture = false, is_direct = false, 
+		is_eof = false, is_line = false, is_stream = false, is_trunc = false, is_wait = false;
 
 	if(!IS_TYPE_T(statement.get(), TOKEN_TYPE_IO_OPERATOR)) {
 		TRACE_EVENT("Invalid io token: " << statement.get().to_string(true), TRACE_TYPE_ERROR);
@@ -1070,11 +1502,56 @@ exe_eval_io(
 
 	switch(statement.get().get_subtype()) {
 		case IO_OPERATOR_TYPE_EXECUTE:
-			statement.move_child_front();
+
+			for(; child_position < statement.get_child_count() - 1; ++child_position) {
+
+				switch(statement.get_child_node(child_position)->get().get_subtype()) {
+					case EXEC_OPERATOR_TYPE_ASYNC:
+						is_async = true;
+						break;
+					case EXEC_OPERATOR_TYPE_CAPTURE:
+						is_capture = true;
+						break;
+					case EXEC_OPERATOR_TYPE_DIRECT:
+						is_direct = true;
+						break;
+					case EXEC_OPERATOR_TYPE_WAIT:
+						is_wait = true;
+						break;
+				}
+			}
+			statement.move_child(child_position);
 			exe_eval_expression(statement, context, stack);
-			system(stack.top().front().get().get_text().c_str());		
+
+			if(is_wait) {
+				handle = (size_t) stack.top().front().get().to_integer();
+			} else {
+				handle = exe_io->spawn(stack.top().front().get().get_text(), is_capture, is_direct);
+			}
 			stack.pop();
 			statement.move_parent();
+
+			if(is_async
+					&& !is_wait) {
+
+				if(to_stack) {
+					EXE_SET_TOKEN_TYPE(input_tok, TOKEN_TYPE_INTEGER, (long) handle);
+					stack.push(exe_create_statement_list(input_tok));
+				}
+			} else {
+				is_capture = exe_io->is_process_captured(handle);
+				status = exe_io->wait(handle, input);
+
+				if(to_stack) {
+
+					if(is_capture) {
+						EXE_SET_TOKEN_TYPE(input_tok, TOKEN_TYPE_VAR_STRING, input);
+						stack.push(exe_create_statement_list(input_tok));
+					}
+					EXE_SET_TOKEN_TYPE(input_tok, TOKEN_TYPE_INTEGER, (long) status);
+					stack.push(exe_create_statement_list(input_tok));
+				}
+			}
 			break;
 		case IO_OPERATOR_TYPE_IN:
 		case IO_OPERATOR_TYPE_OUT:
@@ -1090,25 +1567,29 @@ exe_eval_io(
 						filename = stack.top().front().get().get_text();
 						stack.pop();
 					} else {
-						statement.move_child_front();
+						option_list = statement.get_child_node(0);
 
-						for(; child_position < statement.get_child_count(); ++child_position) {
-							statement.move_child(child_position);
+						for(; child_position < option_list->get_child_count(); ++child_position) {
 
-							switch(statement.get().get_subtype()) {
+							switch(option_list->get_child(child_position)->get().get_subtype()) {
 								case FILE_STREAM_OPERATOR_TYPE_APPEND:
 									is_append = true;
 									break;
 								case FILE_STREAM_OPERATOR_TYPE_BIN:
 									is_binary = true;
 									break;
+								case FILE_STREAM_OPERATOR_TYPE_CHUNK:
+									is_stream = true;
+									break;
+								case FILE_STREAM_OPERATOR_TYPE_LINE:
+									is_line = true;
+									is_stream = true;
+									break;
 								case FILE_STREAM_OPERATOR_TYPE_TRUNC:
 									is_trunc = true;
 									break;
 							}
-							statement.move_parent();
 						}
-						statement.move_parent();
 						statement.move_child(FILE_STREAM_EXPRESSION_CHILD);
 						exe_eval_expression(statement, context, stack);
 						filename = stack.top().front().get().get_text();
@@ -1118,33 +1599,79 @@ exe_eval_io(
 					statement.move_parent();
 					statement.move_parent();
 
-					if(IS_SUBTYPE_T(statement.get(), IO_OPERATOR_TYPE_IN)) {
-						std::ifstream file(filename.c_str(), std::ios::in | (is_binary ? std::ios::binary : 0));
+					if(IS_SUBTYPE_T(statement.get(), IO_OPERATOR_TYPE_IN)
+							&& is_stream) {
+
+						open_count = exe_io->get_open_count();
 
-						if(file) {
-							ss << file.rdbuf();
-							input = ss.str();
-							file.close();
+						if(exe_io->read_file(filename, input, is_binary, is_line)
+								&& to_stack) {
 							EXE_SET_TOKEN_TYPE(input_tok, TOKEN_TYPE_VAR_STRING, input);
 							stack.push(exe_create_statement_list(input_tok));
 						}
+						exe_sta_add_file_open(open_count);
+					} else if(IS_SUBTYPE_T(statement.get(), IO_OPERATOR_TYPE_IN)) {
+						exe_io->flush(filename);
+						input_buf = new buf;
+
+						if(!input_buf) {
+							THROW_EXE_EXT_EXC_W_MESS(filename, EXE_EXT_EXC_OUT_OF_MEMORY);
+						}
+
+						if(to_stack
+								&& input_buf->open(filename, is_binary)) {
+							exe_sta_add(STA_COUNTER_FILE_OPEN);
+							EXE_SET_TOKEN_TYPE(input_tok, TOKEN_TYPE_VAR_STRING, input_buf);
+							stack.push(exe_create_statement_list(input_tok));
+						}
+						input_buf->release();
 					} else {
-						std::ofstream file(filename.c_str(), std::ios::out
-								| (is_append ? std::ios::app : 0)
-								| (is_binary ? std::ios::binary : 0)
-								| (is_trunc ? std::ios::trunc : 0));
+						statement.move_child(IO_OUT_EXPRESSION_CHILD);
+						exe_eval_expression_parts(statement, context, stack, parts);
+						exe_create_segment_list(parts, segments);
+						open_count = exe_io->get_open_count();
+						exe_io->write_file(filename, &segments[0], segments.size(), is_append, is_binary, is_trunc);
+						exe_sta_add_file_open(open_count);
+						statement.move_parent();
+					}
+					break;
+				case STREAM_TYPE_STDIN:
+
+					if(statement.get_child_count()) {
+						option_list = statement.get_child_node(0);
+
+						for(; child_position < option_list->get_child_count(); ++child_position) {
 
-						if(file) {
-							statement.move_child(IO_OUT_EXPRESSION_CHILD);
+							switch(option_list->get_child(child_position)->get().get_subtype()) {
+								case FILE_STREAM_OPERATOR_TYPE_BIN:
+									is_binary = true;
+									break;
+								case FILE_STREAM_OPERATOR_TYPE_CHUNK:
+									is_stream = true;
+									break;
+								case FILE_STREAM_OPERATOR_TYPE_EOF:
+									is_eof = true;
+									break;
+								case FILE_STREAM_OPERATOR_TYPE_LINE:
+									is_line = true;
+									break;
+							}
+						}
+
+						if(statement.get_child_count() > MIN_CHILD_COUNT) {
+							statement.move_child(STDIN_COUNT_CHILD);
 							exe_eval_expression(statement, context, stack);
-							file << stack.top().front().get().get_text();
-							file.close();
+							count = stack.top().front().get().to_integer();
 							stack.pop();
 							statement.move_parent();
+
+							if(is_line
+									&& count <= 0) {
+								TRACE_EVENT("Invalid stdin line count: " << count, TRACE_TYPE_ERROR);
+								THROW_EXE_EXT_EXC_W_MESS("stdin line count " << count, EXE_EXT_EXC_INVAL_PARAM);
+							}
 						}
 					}
-					break;
-				case STREAM_TYPE_STDIN:
 					statement.move_parent();
 					statement.move_parent();
 
@@ -1152,9 +1679,41 @@ exe_eval_io(
 						TRACE_EVENT("Invalid stream token: " << statement.get().to_string(true), TRACE_TYPE_ERROR);
 						THROW_EXE_EXT_EXC_W_MESS(statement.get().to_string(true), EXE_EXT_EXC_INVAL_STREAM_TOKEN);
 					}
-					std::getline(std::cin, input);
-					EXE_SET_TOKEN_TYPE(input_tok, TOKEN_TYPE_VAR_STRING, input);
-					stack.push(exe_create_statement_list(input_tok));
+					exe_io->flush_stdout();
+
+					if(is_line
+							&& count >= 0) {
+
+						for(; count > 0 && exe_io->read_stdin_line(input, is_binary); --count) {
+
+							if(to_stack) {
+								EXE_SET_TOKEN_TYPE(input_tok, TOKEN_TYPE_VAR_STRING, input);
+								value_stmt_vec.push_back(tok_stmt(input_tok));
+							}
+						}
+
+						if(to_stack
+								&& value_stmt_vec.empty()) {
+							EXE_SET_TOKEN_TYPE(input_tok, TOKEN_TYPE_VAR_STRING, std::string());
+							value_stmt_vec.push_back(tok_stmt(input_tok));
+						}
+					} else if(is_stream
+							|| is_eof) {
+						exe_io->read_stdin(input, is_eof ? 0 : (count > 0 ? (size_t) count : IO_FILE_CHUNK_SIZE), is_binary);
+					} else {
+						exe_io->read_stdin_line(input, is_binary);
+					}
+
+					if(to_stack) {
+
+						if(is_line
+								&& count >= 0) {
+							stack.push(value_stmt_vec);
+						} else {
+							EXE_SET_TOKEN_TYPE(input_tok, TOKEN_TYPE_VAR_STRING, input);
+							stack.push(exe_create_statement_list(input_tok));
+						}
+					}
 					break;
 				case STREAM_TYPE_STDOUT:
 					statement.move_parent();
@@ -1166,9 +1725,9 @@ exe_eval_io(
 					}
 					
 					statement.move_child(IO_OUT_EXPRESSION_CHILD);
-					exe_eval_expression(statement, context, stack);
-					std::cout << stack.top().front().get().get_text();
-					stack.pop();
+					exe_eval_expression_parts(statement, context, stack, parts);
+					exe_create_segment_list(parts, segments);
+					exe_io->write_stdout(&segments[0], segments.size());
 					statement.move_parent();
 					break;
 			}
@@ -1221,7 +1780,7 @@ exe_eval_iterator(
 
 	for(; i < statement.get_child_count(); ++i) {
 		statement.move_child(i);
-		value_stmt_vec = exe_cont_get_value(statement.get().get_text(), context, false);
+		value_stmt_vec = exe_cont_get_value(statement.get().get_atom(), context, false);
 
 		if(!IS_CLASS_TYPE_T(value_stmt_vec.at(offset).get(), CLASS_TOKEN_TYPE_TOKEN)) {
 			TRACE_EVENT("Invalid iteratable class token: " << statement.get().to_string(true), TRACE_TYPE_ERROR);
@@ -1285,9 +1844,9 @@ exe_eval_iterator(
 		value_stmt_vec.at(offset).get().set_value(ss.str());
 
 		if(index_ref) {
-			exe_cont_set_value(statement.get().get_text(), value_stmt_vec.at(offset), context, offset, false);
+			exe_cont_set_value(statement.get().get_atom(), value_stmt_vec.at(offset), context, offset, false);
 		} else {
-			exe_cont_set_value(statement.get().get_text(), value_stmt_vec, context, false);
+			exe_cont_set_value(statement.get().get_atom(), value_stmt_vec, context, false);
 		}
 		value_stmt_vec.clear();
 		statement.move_parent();
@@ -1389,7 +1948,7 @@ exe_eval_operation(
 							if(!left_operand.to_integer()
 									|| !right_operand.to_integer()) {
 								TRACE_EVENT("Attempting to divide by zero: " 
-									<< left_operand->to_string(true) << ", " << right_operand->to_string(true), TRACE_TYPE_ERROR);
+									<< left_operand.to_string(true) << ", " << right_operand.to_string(true), TRACE_TYPE_ERROR);
 								THROW_EXE_EXT_EXC_W_MESS(left_operand.to_string(true) << ", " << right_operand.to_string(true), EXE_EXT_EXC_DIVIDE_BY_ZERO);
 							}
 							i_val = left_operand.to_integer() / right_operand.to_integer();
@@ -1472,19 +2031,19 @@ exe_eval_out_list(
 
 	for(; i < statement.get_child_count(); ++i) {
 		statement.move_child(i);
-		value_stmt_vec = exe_cont_get_value(statement.get().get_text(), context, false);
+		value_stmt_vec = exe_cont_get_value(statement.get().get_atom(), context, false);
 
 		switch(subtype) {
 			case OUT_LIST_OPERATOR_TYPE_POP_END:
 				value_stmt = value_stmt_vec.back();
 				value_stmt_vec.erase(value_stmt_vec.end() - 1);
-				exe_cont_set_value(statement.get().get_text(), value_stmt_vec, context, false);
+				exe_cont_set_value(statement.get().get_atom(), value_stmt_vec, context, false);
 				stack.push(exe_create_statement_list(value_stmt));
 				break;
 			case OUT_LIST_OPERATOR_TYPE_POP_FRONT:
 				value_stmt = value_stmt_vec.front();
 				value_stmt_vec.erase(value_stmt_vec.begin());
-				exe_cont_set_value(statement.get().get_text(), value_stmt_vec, context, false);
+				exe_cont_set_value(statement.get().get_atom(), value_stmt_vec, context, false);
 				stack.push(exe_create_statement_list(value_stmt));
 				break;
 			case OUT_LIST_OPERATOR_TYPE_SIZE:
@@ -1532,11 +2091,23 @@ exe_eval_statement(
 	tok_stack &stack
 	)
 {
+	exe_ptr executor = NULL;
 	size_t signal = EXE_SIG_NONE;
 
 	if(parser) {
-		exe_args = arguments;
+		executor = dynamic_cast<exe_ptr>(parser);
+
+		if(!executor) {
+			TRACE_EVENT("Invalid executor evaluation action parameter!", TRACE_TYPE_ERROR);
+			THROW_EXE_EXT_EXC(EXE_EXT_EXC_INVAL_EVAL_ACTION_PARAM);
+		}
+		exe_args = &arguments;
 		exe_par = parser;
+		exe_io = &executor->get_stream();
+		exe_prf = &executor->get_profiler();
+		exe_sta = &executor->get_statistics();
+		exe_bud = &executor->get_budget();
+		exe_exe = executor;
 		signal = exe_eval_statement(parser->get(), context, stack, 0, true);
 		exe_advance_parser(parser);
 	} else {
@@ -1558,7 +2129,9 @@ exe_eval_statement(
 {
 	TRACE_EVENT("+exe_eval_statement", TRACE_TYPE_INFORMATION);
 
+	HPF_OWNER(HPF_OWNER_STACK);
 	size_t signal = EXE_SIG_NONE;
+	bool profiled = (exe_prf && exe_prf->is_enabled());
 		
 	if(!IS_CLASS_TYPE_T(statement.get(), CLASS_TOKEN_TYPE_STATEMENT)) {
 		TRACE_EVENT("Invalid statement class token: " << statement.get().to_string(true), TRACE_TYPE_ERROR);
@@ -1571,6 +2144,27 @@ exe_eval_statement(
 		THROW_EXE_EXT_EXC_W_MESS(statement.get().to_string(true), EXE_EXT_EXC_INVAL_TOKEN_CLASS_TOKEN);
 	}
 
+	if(profiled) {
+		exe_prf->enter(statement.get());
+	}
+
+	if(exe_sta
+			&& exe_sta->is_enabled()) {
+		exe_sta->add_statement(statement.get().get_type());
+	}
+
+	if(exe_bud
+			&& exe_bud->is_enabled()) {
+		exe_bud->add_statement();
+	}
+
+	if(exe_exe
+			&& exe_exe->get_memory().is_enabled()
+			&& exe_exe->get_memory().is_sample_due()) {
+		exe_exe->sample_memory();
+		exe_exe->get_memory().test_limit();
+	}
+
 	switch(statement.get().get_type()) {
 		case TOKEN_TYPE_ASSIGNMENT:
 			exe_eval_assignment(statement, context, stack);
@@ -1585,7 +2179,7 @@ exe_eval_statement(
 			signal = exe_eval_control(statement, context, stack);
 			break;
 		case TOKEN_TYPE_IO_OPERATOR:
-			exe_eval_io(statement, context, stack);
+			exe_eval_io(statement, context, stack, false);
 			break;
 		case TOKEN_TYPE_IN_LIST_OPERATOR:
 			exe_eval_in_list(statement, context, stack);
@@ -1603,6 +2197,10 @@ exe_eval_statement(
 			TRACE_EVENT("Invalid statement token: " << statement.get().to_string(true), TRACE_TYPE_ERROR);
 			THROW_EXE_EXT_EXC_W_MESS(statement.get().to_string(true), EXE_EXT_EXC_INVAL_STMT_TOKEN);
 	}
+
+	if(profiled) {
+		exe_prf->exit();
+	}
 	statement.move_parent();
 
 	TRACE_EVENT("-exe_eval_statement", TRACE_TYPE_INFORMATION);
@@ -1651,18 +2249,15 @@ exe_eval_subroutine(
 {
 	TRACE_EVENT("+exe_eval_subroutine", TRACE_TYPE_INFORMATION);
 	
+	HPF_OWNER(HPF_OWNER_SCOPE);
 	cont sub_cont;
-	size_t i, count = 0;
 	tok_stmt funct_schema;
-	tok_stmt_vector funct_schema_vec = exe_cont_get_value(statement.get().get_text(), context, false);
+	size_t i, count = 0, id = statement.get().get_atom();
+	bool profiled = (exe_prf && exe_prf->is_enabled());
 
 	UNREF_PARAM(index);
-
-	if(index >= funct_schema_vec.size()) {
-		TRACE_EVENT("Attempting to reference non-existent index: " << index, TRACE_TYPE_ERROR);
-		THROW_EXE_EXT_EXC_W_MESS(statement.get().get_text() << "[" << index << "]", EXE_EXT_EXC_REF_TO_NON_EXISTENT_INDEX);
-	}
-	funct_schema = funct_schema_vec.at(index);
+	exe_bud_check();
+	exe_cont_get_function(statement, context, id, index, funct_schema);
 
 	if(!funct_schema.has_children()) {
 		TRACE_EVENT("Attempting to reference non-existent function: " << statement.get().to_string(true), TRACE_TYPE_ERROR);
@@ -1671,7 +2266,7 @@ exe_eval_subroutine(
 	statement.move_child_front();
 
 	if(!IS_CLASS_TYPE_T(statement.get(), CLASS_TOKEN_TYPE_FUNCTION_PARAMETER_LIST)) {
-		TRACE_EVENT("Invalid function parameter class token: " << statement.get().get_type, TRACE_TYPE_ERROR);
+		TRACE_EVENT("Invalid function parameter class token: " << statement.get().get_type(), TRACE_TYPE_ERROR);
 		THROW_EXE_EXT_EXC_W_MESS(statement.get().get_type(), EXE_EXT_EXC_INVAL_FUNCT_PARAM_CLASS_TOKEN);
 	}
 	statement.move_child_front();
@@ -1695,7 +2290,8 @@ exe_eval_subroutine(
 			statement.move_child(i);
 			funct_schema.move_child(i);
 			exe_eval_expression(statement, context, stack);
-			sub_cont.set_value(funct_schema.get().get_text(), stack.top());
+			sub_cont.set_value(funct_schema.get().get_atom(), stack.top());
+			exe_sta_add_copy(stack.top());
 			stack.pop();
 			funct_schema.move_parent();
 			statement.move_parent();
@@ -1705,8 +2301,13 @@ exe_eval_subroutine(
 	statement.move_parent();
 	statement.move_parent();
 	funct_schema.move_parent();
+
+	if(profiled) {
+		exe_prf->enter_call(id);
+	}
 	context.add_child_back(sub_cont);
 	context.move_child_back();
+	exe_sta_add(STA_COUNTER_SCOPE);
 	funct_schema.move_child(FUNCT_SCHEMA_STMT_LIST_CHILD);
 	exe_eval_statement_list(funct_schema, context, stack);
 	funct_schema.move_parent();
@@ -1726,6 +2327,10 @@ exe_eval_subroutine(
 	context.move_parent();
 	context.remove_children();
 
+	if(profiled) {
+		exe_prf->exit_call();
+	}
+
 	TRACE_EVENT("-exe_eval_subroutine", TRACE_TYPE_INFORMATION);
 }
 
@@ -1742,6 +2347,7 @@ exe_eval_using(
 
 	size_t i = 1;
 	par using_par;
+	std::vector<tok_stmt_ptr> import_list;
 
 	UNREF_PARAM(context);
 	UNREF_PARAM(stack);
@@ -1749,7 +2355,7 @@ exe_eval_using(
 	if(exe_par) {
 
 		if(!IS_TYPE_T(statement.get(), TOKEN_TYPE_USING)) {
-			TRACE_EVENT("Invalid using token: " << statement.get().get_type, TRACE_TYPE_ERROR);
+			TRACE_EVENT("Invalid using token: " << statement.get().get_type(), TRACE_TYPE_ERROR);
 			THROW_EXE_EXT_EXC_W_MESS(statement.get().get_type(), EXE_EXT_EXC_INVAL_USING_TOKEN);
 		}
 		statement.move_child_front();
@@ -1759,6 +2365,7 @@ exe_eval_using(
 		using_par.initialize(stack.top().front().get().get_text(), true);
 		stack.pop();
 		using_par.enumerate();
+		exe_sta_add(STA_COUNTER_MODULE);
 		statement.move_parent();
 
 		if(root) {
@@ -1768,8 +2375,9 @@ exe_eval_using(
 			statement.move_parent();
 
 			for(; i < using_par.export_statements().get_link_count() - 1; ++i) {
-				statement.insert_child_node(using_par.export_statement(i).get_root_node(), index + i);
+				import_list.push_back(&using_par.export_statement(i));
 			}
+			statement.splice_child_nodes(import_list, index + 1);
 			statement.move_child(index);
 			statement.move_child_front();
 		}
@@ -1779,4 +2387,22 @@ exe_eval_using(
 	}
 
 	TRACE_EVENT("-exe_eval_using", TRACE_TYPE_INFORMATION);
-}
\ No newline at end of file
+}
+
+size_t 
+exe_node_size(
+	const tok_node *node
+	)
+{
+	size_t i = 0, result = 0;
+
+	if(node) {
+		result = sizeof(tok_node) + node->get().get_text_length();
+
+		for(; i < node->get_child_count(); ++i) {
+			result += exe_node_size(node->get_child(i));
+		}
+	}
+
+	return result;
+}
@@ -21,6 +21,7 @@
 #define EXE_EXT_H_
 
 #include "exe_type.h"
+#include "io.h"
 
 /*
  * Executor extension helper routines
@@ -39,32 +40,32 @@ extern void exe_config_parser(
 	);
 
 extern tok_stmt_vector exe_cont_get_value(
-	const std::string &key,
+	size_t key,
 	cont_tree &context,
 	bool force_global
 	);
 
 extern tok_stmt_vector_ptr exe_cont_get_value(
-	const std::string &key,
+	size_t key,
 	cont_node *context,
 	bool force_global,
 	bool root
 	);
 
 extern bool exe_cont_has_value(
-	const std::string &key,
+	size_t key,
 	cont_tree &context,
 	bool force_global
 	);
 
 extern bool exe_cont_has_value(
-	const std::string &key,
+	size_t key,
 	cont_node *context,
 	bool force_global
 	);
 
 extern void exe_cont_set_value(
-	const std::string &key,
+	size_t key,
 	const tok_stmt &value,
 	cont_tree &context,
 	size_t index,
@@ -72,7 +73,7 @@ extern void exe_cont_set_value(
 	);
 
 extern bool exe_cont_set_value(
-	const std::string &key,
+	size_t key,
 	const tok_stmt &value,
 	cont_node *context,
 	size_t index,
@@ -81,20 +82,25 @@ extern bool exe_cont_set_value(
 	);
 
 extern void exe_cont_set_value(
-	const std::string &key,
+	size_t key,
 	const tok_stmt_vector &value,
 	cont_tree &context,
 	bool force_global
 	);
 
 extern bool exe_cont_set_value(
-	const std::string &key,
+	size_t key,
 	const tok_stmt_vector &value,
 	cont_node *context,
 	bool force_global,
 	bool root
 	);
 
+extern void exe_create_segment_list(
+	tok_part_vector &parts,
+	std::vector<io_segment> &segments
+	);
+
 extern tok_stmt_vector exe_create_statement_list(
 	const tok &token
 	);
@@ -103,9 +109,20 @@ extern tok_stmt_vector exe_create_statement_list(
 	const tok_stmt &statement
 	);
 
+extern bool exe_has_side_effect(
+	const tok_node *node
+	);
+
 /*
  * Executor extension evaluation routines
  */
+extern bool exe_eval_append(
+	tok_stmt &statement,
+	cont_tree &context,
+	tok_stack &stack,
+	size_t key
+	);
+
 extern void exe_eval_assignment(
 	tok_stmt &statement,
 	cont_tree &context,
@@ -157,6 +174,20 @@ extern void exe_eval_expression_helper(
 	tok_stack &operator_stack
 	);
 
+extern void exe_eval_expression_parts(
+	tok_stmt &statement,
+	cont_tree &context,
+	tok_stack &stack,
+	tok_part_vector &parts
+	);
+
+extern void exe_eval_expression_parts_helper(
+	tok_stmt &statement,
+	cont_tree &context,
+	tok_stack &stack,
+	tok_part_vector &parts
+	);
+
 extern void exe_eval_identifier_operator(
 	tok_stmt &statement,
 	cont_tree &context,
@@ -172,7 +203,8 @@ extern void exe_eval_in_list(
 extern void exe_eval_io(
 	tok_stmt &statement,
 	cont_tree &context,
-	tok_stack &stack
+	tok_stack &stack,
+	bool to_stack
 	);
 
 extern void exe_eval_iterator(
@@ -237,4 +269,8 @@ extern void exe_eval_using(
 	bool root
 	);
 
+extern size_t exe_node_size(
+	const tok_node *node
+	);
+
 #endif
\ No newline at end of file
@@ -60,6 +60,7 @@ enum {
 	EXE_EXT_EXC_INVAL_TOKEN_INDEX,
 	EXE_EXT_EXC_INVAL_USING_TOKEN,
 	EXE_EXT_EXC_KEY_NOT_FOUND,
+	EXE_EXT_EXC_OUT_OF_MEMORY,
 	EXE_EXT_EXC_REF_TO_NON_EXISTENT_ARG,
 	EXE_EXT_EXC_REF_TO_NON_EXISTENT_FUNCT,
 	EXE_EXT_EXC_REF_TO_NON_EXISTENT_INDEX,
@@ -102,6 +103,7 @@ enum {
 #define RANGE_COND_STMT_LIST_CHILD 1
 #define RANGE_STMT_COND_EXPR_LIST_CHILD 2
 #define RANGE_STMT_COND_STMT_CHILD 0
+#define STDIN_COUNT_CHILD 1
 #define STREAM_STMT_STREAM_LIST_CHILD 1
 #define UNTIL_COND_STMT_LIST_CHILD 0
 #define UNTIL_COND_STMT_CHILD 1
@@ -109,6 +111,17 @@ enum {
 #define WHILE_COND_STMT_CHILD 0
 #define WHILE_COND_STMT_LIST_CHILD 2
 
+/*
+ * Executor extension thread-local storage
+ * (evaluation state is per thread, so executors may run on several
+ * threads at once)
+ */
+#ifdef _WIN32
+#define EXE_THREAD_LOCAL __declspec(thread)
+#else
+#define EXE_THREAD_LOCAL __thread
+#endif
+
 /*
  * Executor extension strings
  */
@@ -147,6 +160,7 @@ static const std::string EXE_EXT_EXC_STR[] = {
 	"Invalid token index",
 	"Invalid using token",
 	"Key does not exist in this context",
+	"Failed to allocate executor buffer",
 	"Attempting to reference non-existent argument",
 	"Attempting to reference non-existant function",
 	"Attempting to reference non-existent index",
@@ -49,6 +49,7 @@ enum {
 	EXE_SIG_BREAK,
 	EXE_SIG_CONTINUE,
 	EXE_SIG_NONE,
+	EXE_SIG_ABORT,
 };
 
 /*
@@ -57,7 +58,7 @@ enum {
 #define MAX_EXE_EXC_TYPE EXE_EXC_UNALLOC_EVAL_ACTION
 #define MAX_EXE_ACTION_TYPE EXE_ACTION_CONFIG_PARSER
 #define MAX_EXE_EVAL_ACTION_TYPE EXE_EVAL_ACTION_STATEMENT
-#define MAX_EXE_SIG_TYPE EXE_SIG_NONE
+#define MAX_EXE_SIG_TYPE EXE_SIG_ABORT
 
 /*
  * Executor strings
@@ -120,10 +121,20 @@ static const std::string EXE_EVAL_ACTION_STR[] = {
 #define IS_TOKEN_TYPE_T(_T_, _TY_, _S_) (IS_CLASS_TYPE_T(_T_, CLASS_TOKEN_TYPE_TOKEN) && IS_TYPE_T(_T_, _TY_) && IS_SUBTYPE_T(_T_, _S_))
 #define IS_TOKEN_CLASS_TYPE_T(_T_, _C_, _TY_, _S_) (IS_CLASS_TYPE_T(_T_, _C_) && IS_TYPE_T(_T_, _TY_) && IS_SUBTYPE_T(_T_, _S_))
 
+/*
+ * Executor operand type macros
+ * (an addition is numeric only if neither operand is a string and
+ * either operand is a float or both are integers)
+ */
+#define IS_STRING_OPERAND_T(_T_) (IS_TYPE_T(_T_, TOKEN_TYPE_VAR_STRING) || IS_TOKEN_TYPE_T(_T_, TOKEN_TYPE_CONSTANT, CONSTANT_TYPE_ENDLINE))
+#define IS_NUMERIC_OPERATION_T(_L_, _R_) (!IS_STRING_OPERAND_T(_L_) && !IS_STRING_OPERAND_T(_R_)\
+	&& (IS_TYPE_T(_L_, TOKEN_TYPE_FLOAT) || IS_TYPE_T(_R_, TOKEN_TYPE_FLOAT) || (IS_TYPE_T(_L_, TOKEN_TYPE_INTEGER) && IS_TYPE_T(_R_, TOKEN_TYPE_INTEGER))))
+
 /*
  * Executor common types
  */
 typedef std::vector<tok> tok_vector, *tok_vector_ptr;
+typedef std::vector<std::vector<tok_stmt>> tok_part_vector, *tok_part_vector_ptr;
 typedef std::stack<std::vector<tok_stmt>> tok_stack, *tok_stack_ptr;
 typedef void(*exe_action)(par_ptr);
 typedef size_t(*exe_eval_action)(const tok_vector &, par_ptr, cont_tree &, tok_stack &);
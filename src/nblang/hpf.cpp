@@ -0,0 +1,181 @@
+/*
+ * hpf.cpp
+ * Copyright (C) 2013 David Jolly
+ * ----------------------
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <cstdlib>
+#include <iomanip>
+#include <new>
+#include <sstream>
+#include "hpf.h"
+
+//#define HPF_TRACING
+#ifndef HPF_TRACING
+#define TRACE_SUBSYSTEM TRC_SUBSYSTEM_COMMON
+#include "trace.h"
+#else
+#define TRACE_HEADER "hpf"
+#include "trace.h"
+#endif
+
+/*
+ * Calling thread owner
+ */
+static HPF_THREAD_LOCAL size_t hpf_thread_owner = HPF_OWNER_OTHER;
+
+std::atomic<size_t> _hpf::_counts[MAX_HPF_OWNER_TYPE + 1];
+std::atomic<size_t> _hpf::_bytes[MAX_HPF_OWNER_TYPE + 1];
+std::atomic<size_t> _hpf::_current[MAX_HPF_OWNER_TYPE + 1];
+std::atomic<size_t> _hpf::_peaks[MAX_HPF_OWNER_TYPE + 1];
+std::atomic<size_t> _hpf::_total;
+std::atomic<size_t> _hpf::_total_peak;
+
+_hpf::_hpf(void)
+{
+	return;
+}
+
+void 
+_hpf::_raise_peak(
+	std::atomic<size_t> &peak,
+	size_t value
+	)
+{
+	size_t previous = peak.load(std::memory_order_relaxed);
+
+	while((value > previous)
+			&& !peak.compare_exchange_weak(previous, value, std::memory_order_relaxed)) {
+		continue;
+	}
+}
+
+void *
+_hpf::allocate(
+	size_t size
+	)
+{
+	size_t owner = hpf_thread_owner;
+	size_t *header = (size_t *) std::malloc(HPF_HEADER_SIZE + (size ? size : 1));
+
+	if(!header) {
+		throw std::bad_alloc();
+	}
+	header[0] = owner;
+	header[1] = size;
+	_counts[owner].fetch_add(1, std::memory_order_relaxed);
+	_bytes[owner].fetch_add(size, std::memory_order_relaxed);
+	_raise_peak(_peaks[owner], _current[owner].fetch_add(size, std::memory_order_relaxed) + size);
+	_raise_peak(_total_peak, _total.fetch_add(size, std::memory_order_relaxed) + size);
+
+	return ((char *) header) + HPF_HEADER_SIZE;
+}
+
+void 
+_hpf::clear(void)
+{
+	TRACE_EVENT("+_hpf::clear", TRACE_TYPE_INFORMATION);
+
+	size_t owner = 0;
+
+	for(; owner <= MAX_HPF_OWNER_TYPE; ++owner) {
+		_counts[owner].store(0, std::memory_order_relaxed);
+		_bytes[owner].store(0, std::memory_order_relaxed);
+		_peaks[owner].store(_current[owner].load(std::memory_order_relaxed), std::memory_order_relaxed);
+	}
+	_total_peak.store(_total.load(std::memory_order_relaxed), std::memory_order_relaxed);
+
+	TRACE_EVENT("-_hpf::clear", TRACE_TYPE_INFORMATION);
+}
+
+size_t 
+_hpf::get_owner(void)
+{
+	return hpf_thread_owner;
+}
+
+bool 
+_hpf::is_active(void)
+{
+	return _total_peak.load(std::memory_order_relaxed) > 0;
+}
+
+void 
+_hpf::release(
+	void *block
+	)
+{
+	size_t *header = NULL;
+
+	if(block) {
+		header = (size_t *) (((char *) block) - HPF_HEADER_SIZE);
+		_current[header[0]].fetch_sub(header[1], std::memory_order_relaxed);
+		_total.fetch_sub(header[1], std::memory_order_relaxed);
+		std::free(header);
+	}
+}
+
+size_t 
+_hpf::set_owner(
+	size_t owner
+	)
+{
+	size_t result = hpf_thread_owner;
+
+	hpf_thread_owner = (owner > MAX_HPF_OWNER_TYPE) ? HPF_OWNER_OTHER : owner;
+
+	return result;
+}
+
+std::string 
+_hpf::to_string(void)
+{
+	TRACE_EVENT("+_hpf::to_string", TRACE_TYPE_INFORMATION);
+
+	std::stringstream ss;
+	size_t owner = 0, count = 0, bytes = 0;
+
+	ss << "Heap profile (bytes):" << std::endl << std::setw(12) << "allocations" << std::setw(16) << "allocated" 
+		<< std::setw(16) << "current" << std::setw(16) << "peak" << "  owner";
+
+	for(; owner <= MAX_HPF_OWNER_TYPE; ++owner) {
+		count += _counts[owner].load(std::memory_order_relaxed);
+		bytes += _bytes[owner].load(std::memory_order_relaxed);
+		ss << std::endl << std::setw(12) << _counts[owner].load(std::memory_order_relaxed) 
+			<< std::setw(16) << _bytes[owner].load(std::memory_order_relaxed) 
+			<< std::setw(16) << _current[owner].load(std::memory_order_relaxed) 
+			<< std::setw(16) << _peaks[owner].load(std::memory_order_relaxed) << "  " << HPF_OWNER_STRING(owner);
+	}
+	ss << std::endl << std::setw(12) << count << std::setw(16) << bytes << std::setw(16) << _total.load(std::memory_order_relaxed) 
+		<< std::setw(16) << _total_peak.load(std::memory_order_relaxed) << "  total";
+
+	TRACE_EVENT("-_hpf::to_string", TRACE_TYPE_INFORMATION);
+
+	return ss.str();
+}
+
+_hpf_owner::_hpf_owner(
+	size_t owner
+	) :
+		_previous(hpf::set_owner(owner))
+{
+	return;
+}
+
+_hpf_owner::~_hpf_owner(void)
+{
+	hpf::set_owner(_previous);
+}
@@ -0,0 +1,182 @@
+/*
+ * hpf.h
+ * Copyright (C) 2013 David Jolly
+ * ----------------------
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef HPF_H_
+#define HPF_H_
+
+#include <atomic>
+#include <cstddef>
+#include "hpf_type.h"
+
+/*
+ * Heap profile class
+ * (counts, bytes and peaks of heap blocks, attributed to the owner active
+ * on the allocating thread; blocks are routed here by the global operator
+ * new and delete of a HEAP_PROFILING build)
+ */
+typedef class _hpf {
+
+	public:
+
+		/*
+		 * Allocate a profiled block
+		 * @param size block size, in bytes
+		 * @return block pointer
+		 */
+		static void *allocate(
+			size_t size
+			);
+
+		/*
+		 * Clear all heap profile counts
+		 */
+		static void clear(void);
+
+		/*
+		 * Retrieve the owner active on the calling thread
+		 * @return owner type
+		 */
+		static size_t get_owner(void);
+
+		/*
+		 * Determine if any profiled block was allocated
+		 * @return true if a block was allocated, false otherwise
+		 */
+		static bool is_active(void);
+
+		/*
+		 * Release a profiled block
+		 * @param block block pointer
+		 */
+		static void release(
+			void *block
+			);
+
+		/*
+		 * Set the owner active on the calling thread
+		 * @param owner owner type
+		 * @return previous owner type
+		 */
+		static size_t set_owner(
+			size_t owner
+			);
+
+		/*
+		 * Heap profile string representation
+		 * @return heap profile report, per owner
+		 */
+		static std::string to_string(void);
+
+	protected:
+
+		/*
+		 * Heap profile constructor
+		 * (the heap profile is only accessed through static routines)
+		 */
+		_hpf(void);
+
+		/*
+		 * Raise a peak to a value
+		 * @param peak peak object reference
+		 * @param value current value
+		 */
+		static void _raise_peak(
+			std::atomic<size_t> &peak,
+			size_t value
+			);
+
+		/*
+		 * Allocation counts, per owner
+		 */
+		static std::atomic<size_t> _counts[MAX_HPF_OWNER_TYPE + 1];
+
+		/*
+		 * Allocated bytes, per owner
+		 */
+		static std::atomic<size_t> _bytes[MAX_HPF_OWNER_TYPE + 1];
+
+		/*
+		 * Current bytes, per owner
+		 */
+		static std::atomic<size_t> _current[MAX_HPF_OWNER_TYPE + 1];
+
+		/*
+		 * Peak bytes, per owner
+		 */
+		static std::atomic<size_t> _peaks[MAX_HPF_OWNER_TYPE + 1];
+
+		/*
+		 * Current total bytes
+		 */
+		static std::atomic<size_t> _total;
+
+		/*
+		 * Peak total bytes
+		 */
+		static std::atomic<size_t> _total_peak;
+
+} hpf, *hpf_ptr;
+
+/*
+ * Heap profile owner scope class
+ * (sets the calling thread's owner for its lifetime; see HPF_OWNER)
+ */
+typedef class _hpf_owner {
+
+	public:
+
+		/*
+		 * Heap profile owner scope constructor
+		 * @param owner owner type
+		 */
+		_hpf_owner(
+			size_t owner
+			);
+
+		/*
+		 * Heap profile owner scope destructor
+		 */
+		virtual ~_hpf_owner(void);
+
+	protected:
+
+		/*
+		 * Heap profile owner scope copy constructor
+		 * (owner scopes are not copied)
+		 */
+		_hpf_owner(
+			const _hpf_owner &other
+			);
+
+		/*
+		 * Heap profile owner scope assignment
+		 * (owner scopes are not copied)
+		 */
+		_hpf_owner &operator=(
+			const _hpf_owner &other
+			);
+
+		/*
+		 * Previous owner type
+		 */
+		size_t _previous;
+
+} hpf_owner, *hpf_owner_ptr;
+
+#endif
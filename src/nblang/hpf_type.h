@@ -0,0 +1,86 @@
+/*
+ * hpf_type.h
+ * Copyright (C) 2013 David Jolly
+ * ----------------------
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef HPF_TYPE_H_
+#define HPF_TYPE_H_
+
+#include <string>
+
+class _hpf;
+typedef _hpf hpf, *hpf_ptr;
+
+class _hpf_owner;
+typedef _hpf_owner hpf_owner, *hpf_owner_ptr;
+
+/*
+ * Heap profile owner types
+ */
+enum {
+	HPF_OWNER_OTHER = 0,
+	HPF_OWNER_FUNCTION_COPY,
+	HPF_OWNER_PARSER,
+	HPF_OWNER_SCOPE,
+	HPF_OWNER_STACK,
+};
+
+/*
+ * Max heap profile types
+ */
+#define MAX_HPF_OWNER_TYPE HPF_OWNER_STACK
+
+/*
+ * Heap profile block header size, in bytes
+ * (holds the owner and size of each block; a multiple of the largest
+ * fundamental alignment)
+ */
+#define HPF_HEADER_SIZE 16
+
+/*
+ * Heap profile thread-local storage
+ */
+#ifdef _WIN32
+#define HPF_THREAD_LOCAL __declspec(thread)
+#else
+#define HPF_THREAD_LOCAL __thread
+#endif
+
+/*
+ * Heap profile strings
+ */
+static const std::string HPF_OWNER_STR[] = {
+	"other", "function copy", "parser", "scope", "value stack",
+};
+
+/*
+ * Heap profile string lookup macros
+ */
+#define HPF_OWNER_STRING(_T_) (_T_ > MAX_HPF_OWNER_TYPE ? "unknown" : HPF_OWNER_STR[_T_])
+
+/*
+ * Heap profile owner macros
+ * With HEAP_PROFILING defined (debug builds), allocations made while the
+ * enclosing scope is active are attributed to the given owner
+ */
+#ifdef HEAP_PROFILING
+#define HPF_OWNER(_T_) hpf_owner hpf_owner_scope(_T_)
+#else
+#define HPF_OWNER(_T_)
+#endif
+
+#endif
@@ -0,0 +1,1121 @@
+/*
+ * io.cpp
+ * Copyright (C) 2013 David Jolly
+ * ----------------------
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <atomic>
+#include <cctype>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <sstream>
+#include <stdexcept>
+#include <vector>
+#include "buf.h"
+#include "io.h"
+#include "lang.h"
+
+#ifndef _WIN32
+#include <cerrno>
+#include <fcntl.h>
+#include <spawn.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+extern char **environ;
+#else
+#include <fcntl.h>
+#include <io.h>
+#endif
+
+//#define IO_TRACING
+#ifndef IO_TRACING
+#define TRACE_SUBSYSTEM TRC_SUBSYSTEM_EXECUTOR
+#include "trace.h"
+#else
+#define TRACE_HEADER "io"
+#include "trace.h"
+#endif
+
+/*
+ * Select default stdout buffering policy
+ * @return line policy if stdout is a terminal, block policy otherwise
+ */
+static size_t 
+io_default_stdout_policy(void)
+{
+#ifndef _WIN32
+	return isatty(fileno(stdout)) ? IO_STDOUT_POLICY_LINE : IO_STDOUT_POLICY_BLOCK;
+#else
+	return _isatty(_fileno(stdout)) ? IO_STDOUT_POLICY_LINE : IO_STDOUT_POLICY_BLOCK;
+#endif
+}
+
+/*
+ * Stdin buffer setup flag
+ * (statically initialized, so it is valid even for io objects
+ * constructed during static initialization)
+ */
+static std::atomic_flag io_stdin_buffered = ATOMIC_FLAG_INIT;
+
+/*
+ * Enlarge the stdin buffer ahead of any reads
+ * (called once, when the first io object is constructed)
+ */
+static void 
+io_buffer_stdin(void)
+{
+	setvbuf(stdin, NULL, _IOFBF, IO_STDIN_BUFFER_SIZE);
+}
+
+/*
+ * Set stdin translation mode
+ * (only meaningful where text mode translates line endings)
+ * @param is_binary true for binary mode, false for text mode
+ */
+static void 
+io_set_stdin_mode(
+	bool is_binary
+	)
+{
+#ifndef _WIN32
+	UNREF_PARAM(is_binary);
+#else
+	static bool binary = false;
+
+	if(binary != is_binary) {
+		_setmode(_fileno(stdin), is_binary ? _O_BINARY : _O_TEXT);
+		binary = is_binary;
+	}
+#endif
+}
+
+/*
+ * Split a command into whitespace delimited arguments, honoring quotes
+ * @param command command string reference
+ * @param arguments argument vector reference
+ */
+static void 
+io_split_command(
+	const std::string &command,
+	std::vector<std::string> &arguments
+	)
+{
+	char quote = 0;
+	bool has_argument = false;
+	std::string argument;
+	std::string::const_iterator ch = command.begin();
+
+	for(; ch != command.end(); ++ch) {
+
+		if(quote) {
+
+			if(*ch == quote) {
+				quote = 0;
+			} else {
+				argument += *ch;
+			}
+		} else if(*ch == '\'' || *ch == '\"') {
+			quote = *ch;
+			has_argument = true;
+		} else if(isspace((unsigned char) *ch)) {
+
+			if(has_argument) {
+				arguments.push_back(argument);
+				argument.clear();
+				has_argument = false;
+			}
+		} else {
+			argument += *ch;
+			has_argument = true;
+		}
+	}
+
+	if(has_argument) {
+		arguments.push_back(argument);
+	}
+}
+
+_io::_io(void) :
+	_async(false),
+	_open_count(0),
+	_process_handle(0),
+	_stdin_line(NULL),
+	_stdin_line_size(0),
+	_stdout_policy(io_default_stdout_policy()),
+	_stdout_size(IO_STDOUT_BUFFER_SIZE),
+	_tick(0)
+{
+	TRACE_EVENT("+_io::_io", TRACE_TYPE_INFORMATION);
+
+	if(!io_stdin_buffered.test_and_set()) {
+		io_buffer_stdin();
+	}
+
+	TRACE_EVENT("-_io::_io", TRACE_TYPE_INFORMATION);
+}
+
+_io::_io(
+	const _io &other
+	) :
+		_async(other._async),
+		_open_count(0),
+		_process_handle(0),
+		_stdin_line(NULL),
+		_stdin_line_size(0),
+		_stdout_policy(other._stdout_policy),
+		_stdout_size(other._stdout_size),
+		_tick(0)
+{
+	TRACE_EVENT("+_io::_io", TRACE_TYPE_INFORMATION);
+	TRACE_EVENT("-_io::_io", TRACE_TYPE_INFORMATION);
+}
+
+_io::~_io(void)
+{
+	TRACE_EVENT("+_io::~_io", TRACE_TYPE_INFORMATION);
+
+	clear();
+	free(_stdin_line);
+
+	TRACE_EVENT("-_io::~_io", TRACE_TYPE_INFORMATION);
+}
+
+_io &
+_io::operator=(
+	const _io &other
+	)
+{
+	TRACE_EVENT("+_io::operator=", TRACE_TYPE_INFORMATION);
+
+	if(this != &other) {
+		clear();
+		set_async(other._async);
+		_stdout_policy = other._stdout_policy;
+		_stdout_size = other._stdout_size;
+	}
+
+	TRACE_EVENT("-_io::operator=", TRACE_TYPE_INFORMATION);
+
+	return *this;
+}
+
+void 
+_io::_close_file(
+	const std::string &path
+	)
+{
+	TRACE_EVENT("+_io::_close_file", TRACE_TYPE_VERBOSE);
+
+	std::map<std::string, io_file_ptr>::iterator file = _files.find(path);
+
+	if(file != _files.end()) {
+		_writer.drain();
+		file->second->stream.close();
+		delete [] file->second->buffer;
+		delete file->second;
+		_files.erase(file);
+	}
+
+	TRACE_EVENT("-_io::_close_file", TRACE_TYPE_VERBOSE);
+}
+
+void 
+_io::_close_reader(
+	const std::string &path
+	)
+{
+	TRACE_EVENT("+_io::_close_reader", TRACE_TYPE_VERBOSE);
+
+	std::map<std::string, io_reader_ptr>::iterator reader = _readers.find(path);
+
+	if(reader != _readers.end()) {
+		reader->second->stream.close();
+		delete [] reader->second->buffer;
+		delete reader->second;
+		_readers.erase(reader);
+	}
+
+	TRACE_EVENT("-_io::_close_reader", TRACE_TYPE_VERBOSE);
+}
+
+void 
+_io::_collect_process(
+	io_process_ptr process
+	)
+{
+	TRACE_EVENT("+_io::_collect_process", TRACE_TYPE_VERBOSE);
+
+	if(!process->done) {
+#ifndef _WIN32
+		int status = 0;
+		ssize_t count;
+		char buffer[IO_FILE_CHUNK_SIZE];
+
+		if(process->output_fd >= 0) {
+
+			for(;;) {
+				count = read(process->output_fd, buffer, IO_FILE_CHUNK_SIZE);
+
+				if(count > 0) {
+					process->output.append(buffer, (size_t) count);
+				} else if(!count
+						|| errno != EINTR) {
+					break;
+				}
+			}
+			close(process->output_fd);
+			process->output_fd = -1;
+		}
+
+		while(waitpid((pid_t) process->pid, &status, 0) < 0) {
+
+			if(errno != EINTR) {
+				status = IO_EXEC_STATUS_NOT_FOUND << 8;
+				break;
+			}
+		}
+
+		if(WIFEXITED(status)) {
+			process->status = WEXITSTATUS(status);
+		} else if(WIFSIGNALED(status)) {
+			process->status = IO_EXEC_STATUS_SIGNAL_BASE + WTERMSIG(status);
+		} else {
+			process->status = status;
+		}
+#endif
+		process->done = true;
+	}
+
+	TRACE_EVENT("-_io::_collect_process", TRACE_TYPE_VERBOSE);
+}
+
+void 
+_io::_evict_file(void)
+{
+	TRACE_EVENT("+_io::_evict_file", TRACE_TYPE_VERBOSE);
+
+	std::map<std::string, io_file_ptr>::iterator file = _files.begin(), oldest = _files.end();
+
+	for(; file != _files.end(); ++file) {
+
+		if(oldest == _files.end()
+				|| file->second->last_use < oldest->second->last_use) {
+			oldest = file;
+		}
+	}
+
+	if(oldest != _files.end()) {
+		TRACE_EVENT("Evicting file: " << oldest->first, TRACE_TYPE_VERBOSE);
+		_close_file(oldest->first);
+	}
+
+	TRACE_EVENT("-_io::_evict_file", TRACE_TYPE_VERBOSE);
+}
+
+void 
+_io::_evict_reader(void)
+{
+	TRACE_EVENT("+_io::_evict_reader", TRACE_TYPE_VERBOSE);
+
+	std::map<std::string, io_reader_ptr>::iterator reader = _readers.begin(), oldest = _readers.end();
+
+	for(; reader != _readers.end(); ++reader) {
+
+		if(oldest == _readers.end()
+				|| reader->second->last_use < oldest->second->last_use) {
+			oldest = reader;
+		}
+	}
+
+	if(oldest != _readers.end()) {
+		TRACE_EVENT("Evicting reader: " << oldest->first, TRACE_TYPE_VERBOSE);
+		_close_reader(oldest->first);
+	}
+
+	TRACE_EVENT("-_io::_evict_reader", TRACE_TYPE_VERBOSE);
+}
+
+void 
+_io::_flush_stdout_buffer(void)
+{
+	TRACE_EVENT("+_io::_flush_stdout_buffer", TRACE_TYPE_VERBOSE);
+
+	if(_async) {
+
+		if(!_stdout_buffer.empty()) {
+			_writer.push(std::cout, _stdout_buffer, true);
+		}
+	} else {
+
+		if(!_stdout_buffer.empty()) {
+			std::cout.write(_stdout_buffer.c_str(), _stdout_buffer.size());
+			_stdout_buffer.clear();
+		}
+		std::cout.flush();
+	}
+
+	TRACE_EVENT("-_io::_flush_stdout_buffer", TRACE_TYPE_VERBOSE);
+}
+
+io_file_ptr 
+_io::_open_file(
+	const std::string &path,
+	std::ios::openmode mode
+	)
+{
+	TRACE_EVENT("+_io::_open_file", TRACE_TYPE_VERBOSE);
+
+	io_file_ptr file = NULL;
+
+	_close_file(path);
+	buf::detach(path);
+
+	if(!(mode & std::ios::app)) {
+		_close_reader(path);
+	}
+
+	if(_files.size() >= IO_FILE_CACHE_MAX) {
+		_evict_file();
+	}
+	file = new io_file;
+
+	if(!file) {
+		THROW_IO_EXC_W_MESS(path, IO_EXC_OUT_OF_MEMORY);
+	}
+	file->buffer = new char[IO_FILE_BUFFER_SIZE];
+
+	if(!file->buffer) {
+		delete file;
+		THROW_IO_EXC_W_MESS(path, IO_EXC_OUT_OF_MEMORY);
+	}
+	file->mode = mode;
+	file->stream.rdbuf()->pubsetbuf(file->buffer, IO_FILE_BUFFER_SIZE);
+	file->stream.open(path.c_str(), mode);
+
+	if(!file->stream) {
+		TRACE_EVENT("Failed to open file: " << path, TRACE_TYPE_WARNING);
+		delete [] file->buffer;
+		delete file;
+		file = NULL;
+	} else {
+		_files.insert(std::pair<std::string, io_file_ptr>(path, file));
+		++_open_count;
+	}
+
+	TRACE_EVENT("-_io::_open_file", TRACE_TYPE_VERBOSE);
+
+	return file;
+}
+
+io_reader_ptr 
+_io::_open_reader(
+	const std::string &path,
+	std::ios::openmode mode
+	)
+{
+	TRACE_EVENT("+_io::_open_reader", TRACE_TYPE_VERBOSE);
+
+	io_reader_ptr reader = NULL;
+
+	_close_reader(path);
+
+	if(_readers.size() >= IO_READER_CACHE_MAX) {
+		_evict_reader();
+	}
+	reader = new io_reader;
+
+	if(!reader) {
+		THROW_IO_EXC_W_MESS(path, IO_EXC_OUT_OF_MEMORY);
+	}
+	reader->buffer = new char[IO_FILE_BUFFER_SIZE];
+
+	if(!reader->buffer) {
+		delete reader;
+		THROW_IO_EXC_W_MESS(path, IO_EXC_OUT_OF_MEMORY);
+	}
+	reader->last_use = _tick;
+	reader->mode = mode;
+	reader->stream.rdbuf()->pubsetbuf(reader->buffer, IO_FILE_BUFFER_SIZE);
+	reader->stream.open(path.c_str(), mode);
+
+	if(!reader->stream) {
+		TRACE_EVENT("Failed to open reader: " << path, TRACE_TYPE_WARNING);
+		delete [] reader->buffer;
+		delete reader;
+		reader = NULL;
+	} else {
+		_readers.insert(std::pair<std::string, io_reader_ptr>(path, reader));
+		++_open_count;
+	}
+
+	TRACE_EVENT("-_io::_open_reader", TRACE_TYPE_VERBOSE);
+
+	return reader;
+}
+
+void 
+_io::_write_stream(
+	std::ostream &stream,
+	const io_segment *segments,
+	size_t count,
+	bool is_flush
+	)
+{
+	TRACE_EVENT("+_io::_write_stream", TRACE_TYPE_VERBOSE);
+
+	size_t i = 0, length = 0;
+	std::string data;
+
+	if(_async) {
+
+		if(count == 1) {
+			_writer.push(stream, segments->data, segments->length, is_flush);
+		} else {
+
+			for(; i < count; ++i) {
+				length += segments[i].length;
+			}
+			data.reserve(length);
+
+			for(i = 0; i < count; ++i) {
+				data.append(segments[i].data, segments[i].length);
+			}
+			_writer.push(stream, data, is_flush);
+		}
+	} else {
+
+		for(; i < count; ++i) {
+			stream.write(segments[i].data, segments[i].length);
+		}
+
+		if(is_flush) {
+			stream.flush();
+		}
+	}
+
+	TRACE_EVENT("-_io::_write_stream", TRACE_TYPE_VERBOSE);
+}
+
+void 
+_io::clear(void)
+{
+	TRACE_EVENT("+_io::clear", TRACE_TYPE_INFORMATION);
+
+	flush_stdout();
+
+	while(!_files.empty()) {
+		_close_file(_files.begin()->first);
+	}
+
+	while(!_readers.empty()) {
+		_close_reader(_readers.begin()->first);
+	}
+
+	while(!_processes.empty()) {
+		_collect_process(_processes.begin()->second);
+		delete _processes.begin()->second;
+		_processes.erase(_processes.begin());
+	}
+	_process_handle = 0;
+	_tick = 0;
+
+	TRACE_EVENT("-_io::clear", TRACE_TYPE_INFORMATION);
+}
+
+void 
+_io::flush(void)
+{
+	TRACE_EVENT("+_io::flush", TRACE_TYPE_INFORMATION);
+
+	std::map<std::string, io_file_ptr>::iterator file = _files.begin();
+
+	flush_stdout();
+
+	for(; file != _files.end(); ++file) {
+		file->second->stream.flush();
+	}
+
+	TRACE_EVENT("-_io::flush", TRACE_TYPE_INFORMATION);
+}
+
+void 
+_io::flush(
+	const std::string &path
+	)
+{
+	TRACE_EVENT("+_io::flush", TRACE_TYPE_INFORMATION);
+
+	std::map<std::string, io_file_ptr>::iterator file = _files.find(path);
+
+	if(file != _files.end()) {
+		_writer.drain();
+		file->second->stream.flush();
+	}
+
+	TRACE_EVENT("-_io::flush", TRACE_TYPE_INFORMATION);
+}
+
+void 
+_io::flush_stdout(void)
+{
+	TRACE_EVENT("+_io::flush_stdout", TRACE_TYPE_VERBOSE);
+
+	_flush_stdout_buffer();
+	_writer.drain();
+	std::cout.flush();
+
+	TRACE_EVENT("-_io::flush_stdout", TRACE_TYPE_VERBOSE);
+}
+
+size_t 
+_io::get_file_count(void)
+{
+	TRACE_EVENT("_io::get_file_count", TRACE_TYPE_VERBOSE);
+
+	return _files.size();
+}
+
+size_t 
+_io::get_open_count(void)
+{
+	TRACE_EVENT("_io::get_open_count", TRACE_TYPE_VERBOSE);
+
+	return _open_count;
+}
+
+size_t 
+_io::get_process_count(void)
+{
+	TRACE_EVENT("_io::get_process_count", TRACE_TYPE_VERBOSE);
+
+	return _processes.size();
+}
+
+size_t 
+_io::get_reader_count(void)
+{
+	TRACE_EVENT("_io::get_reader_count", TRACE_TYPE_VERBOSE);
+
+	return _readers.size();
+}
+
+size_t 
+_io::get_stdout_policy(void)
+{
+	TRACE_EVENT("_io::get_stdout_policy", TRACE_TYPE_VERBOSE);
+
+	return _stdout_policy;
+}
+
+size_t 
+_io::get_stdout_size(void)
+{
+	TRACE_EVENT("_io::get_stdout_size", TRACE_TYPE_VERBOSE);
+
+	return _stdout_size;
+}
+
+bool 
+_io::is_async(void)
+{
+	TRACE_EVENT("_io::is_async", TRACE_TYPE_VERBOSE);
+
+	return _async;
+}
+
+bool 
+_io::is_process_captured(
+	size_t handle
+	)
+{
+	TRACE_EVENT("+_io::is_process_captured", TRACE_TYPE_VERBOSE);
+
+	std::map<size_t, io_process_ptr>::iterator process = _processes.find(handle);
+
+	if(process == _processes.end()) {
+		TRACE_EVENT("Invalid process handle: " << handle, TRACE_TYPE_ERROR);
+		THROW_IO_EXC_W_MESS(handle, IO_EXC_INVAL_PROCESS);
+	}
+
+	TRACE_EVENT("-_io::is_process_captured", TRACE_TYPE_VERBOSE);
+
+	return process->second->capture;
+}
+
+bool 
+_io::read_file(
+	const std::string &path,
+	std::string &data,
+	bool is_binary,
+	bool is_line
+	)
+{
+	TRACE_EVENT("+_io::read_file", TRACE_TYPE_INFORMATION);
+
+	io_reader_ptr reader = NULL;
+	std::ios::openmode mode = std::ios::in
+			| (is_binary ? std::ios::binary : (std::ios::openmode) 0);
+	std::map<std::string, io_reader_ptr>::iterator entry = _readers.find(path);
+
+	data.clear();
+
+	if(entry != _readers.end()
+			&& entry->second->mode == mode) {
+		reader = entry->second;
+	} else {
+		flush(path);
+		reader = _open_reader(path, mode);
+	}
+
+	if(reader) {
+		reader->last_use = ++_tick;
+
+		if(is_line) {
+			std::getline(reader->stream, data);
+
+			if(!reader->stream.eof()) {
+				data += '\n';
+			}
+		} else {
+			data.resize(IO_FILE_CHUNK_SIZE);
+			reader->stream.read(&data[0], IO_FILE_CHUNK_SIZE);
+			data.resize((size_t) reader->stream.gcount());
+		}
+
+		if(data.empty()) {
+			TRACE_EVENT("Reader reached end of file: " << path, TRACE_TYPE_VERBOSE);
+			_close_reader(path);
+		}
+	}
+
+	TRACE_EVENT("-_io::read_file", TRACE_TYPE_INFORMATION);
+
+	return reader != NULL;
+}
+
+bool 
+_io::read_stdin(
+	std::string &data,
+	size_t length,
+	bool is_binary
+	)
+{
+	TRACE_EVENT("+_io::read_stdin", TRACE_TYPE_INFORMATION);
+
+	size_t count;
+	char buffer[IO_FILE_CHUNK_SIZE];
+
+	data.clear();
+	io_set_stdin_mode(is_binary);
+
+	if(length) {
+		data.resize(length);
+		data.resize(fread(&data[0], 1, length, stdin));
+	} else {
+
+		while((count = fread(buffer, 1, IO_FILE_CHUNK_SIZE, stdin)) > 0) {
+			data.append(buffer, count);
+		}
+	}
+
+	TRACE_EVENT("-_io::read_stdin", TRACE_TYPE_INFORMATION);
+
+	return !data.empty();
+}
+
+bool 
+_io::read_stdin_line(
+	std::string &data,
+	bool is_binary
+	)
+{
+	TRACE_EVENT("+_io::read_stdin_line", TRACE_TYPE_INFORMATION);
+
+	bool result = false;
+
+	data.clear();
+	io_set_stdin_mode(is_binary);
+
+#ifndef _WIN32
+	ssize_t count = getline(&_stdin_line, &_stdin_line_size, stdin);
+
+	if(count > 0) {
+		result = true;
+
+		if(_stdin_line[count - 1] == '\n') {
+			--count;
+		}
+		data.assign(_stdin_line, (size_t) count);
+	}
+#else
+	size_t count;
+
+	if(!_stdin_line) {
+		_stdin_line_size = IO_FILE_CHUNK_SIZE;
+		_stdin_line = (char *) malloc(_stdin_line_size);
+
+		if(!_stdin_line) {
+			_stdin_line_size = 0;
+			THROW_IO_EXC(IO_EXC_OUT_OF_MEMORY);
+		}
+	}
+
+	while(fgets(_stdin_line, (int) _stdin_line_size, stdin)) {
+		result = true;
+		count = strlen(_stdin_line);
+
+		if(count
+				&& _stdin_line[count - 1] == '\n') {
+			data.append(_stdin_line, count - 1);
+			break;
+		}
+		data.append(_stdin_line, count);
+	}
+#endif
+
+	TRACE_EVENT("-_io::read_stdin_line", TRACE_TYPE_INFORMATION);
+
+	return result;
+}
+
+void 
+_io::set_async(
+	bool is_async
+	)
+{
+	TRACE_EVENT("+_io::set_async", TRACE_TYPE_INFORMATION);
+
+	if(_async != is_async) {
+		flush_stdout();
+
+		if(!is_async) {
+			_writer.stop();
+		}
+		_async = is_async;
+	}
+
+	TRACE_EVENT("-_io::set_async", TRACE_TYPE_INFORMATION);
+}
+
+void 
+_io::set_stdout_policy(
+	size_t policy,
+	size_t size
+	)
+{
+	TRACE_EVENT("+_io::set_stdout_policy", TRACE_TYPE_INFORMATION);
+
+	if(policy > MAX_IO_STDOUT_POLICY_TYPE) {
+		TRACE_EVENT("Invalid stdout policy: " << policy, TRACE_TYPE_ERROR);
+		THROW_IO_EXC_W_MESS(policy, IO_EXC_INVAL_STDOUT_POLICY);
+	}
+	flush_stdout();
+	_stdout_policy = policy;
+	_stdout_size = size ? size : IO_STDOUT_BUFFER_SIZE;
+
+	TRACE_EVENT("-_io::set_stdout_policy", TRACE_TYPE_INFORMATION);
+}
+
+size_t 
+_io::spawn(
+	const std::string &command,
+	bool is_capture,
+	bool is_direct
+	)
+{
+	TRACE_EVENT("+_io::spawn", TRACE_TYPE_INFORMATION);
+
+	io_process_ptr process = new io_process;
+
+	if(!process) {
+		THROW_IO_EXC_W_MESS(command, IO_EXC_OUT_OF_MEMORY);
+	}
+	process->capture = is_capture;
+	process->output_fd = -1;
+	process->pid = 0;
+	process->done = false;
+	process->status = 0;
+	flush();
+	buf::detach_all();
+
+#ifndef _WIN32
+	pid_t pid = 0;
+	int result, pipe_fd[2] = { -1, -1 };
+	std::vector<char *> argv;
+	std::vector<std::string> arguments;
+	std::vector<std::string>::iterator argument;
+	posix_spawn_file_actions_t actions;
+
+	if(is_direct) {
+		io_split_command(command, arguments);
+	} else {
+		arguments.push_back(IO_EXEC_SHELL);
+		arguments.push_back(IO_EXEC_SHELL_FLAG);
+		arguments.push_back(command);
+	}
+
+	for(argument = arguments.begin(); argument != arguments.end(); ++argument) {
+		argv.push_back(&(*argument)[0]);
+	}
+	argv.push_back(NULL);
+
+	if(is_capture) {
+
+		if(pipe(pipe_fd)) {
+			delete process;
+			THROW_IO_EXC_W_MESS(command, IO_EXC_PIPE_FAILED);
+		}
+		fcntl(pipe_fd[0], F_SETFD, FD_CLOEXEC);
+	}
+	posix_spawn_file_actions_init(&actions);
+
+	if(is_capture) {
+		posix_spawn_file_actions_addclose(&actions, pipe_fd[0]);
+		posix_spawn_file_actions_adddup2(&actions, pipe_fd[1], STDOUT_FILENO);
+		posix_spawn_file_actions_addclose(&actions, pipe_fd[1]);
+	}
+
+	if(arguments.empty()) {
+		result = ENOENT;
+	} else if(is_direct) {
+		result = posix_spawnp(&pid, argv.front(), &actions, NULL, &argv[0], environ);
+	} else {
+		result = posix_spawn(&pid, IO_EXEC_SHELL, &actions, NULL, &argv[0], environ);
+	}
+	posix_spawn_file_actions_destroy(&actions);
+
+	if(is_capture) {
+		close(pipe_fd[1]);
+		process->output_fd = pipe_fd[0];
+	}
+
+	if(result) {
+		TRACE_EVENT("Failed to spawn process: " << command, TRACE_TYPE_WARNING);
+
+		if(process->output_fd >= 0) {
+			close(process->output_fd);
+			process->output_fd = -1;
+		}
+		process->done = true;
+		process->status = IO_EXEC_STATUS_NOT_FOUND;
+	} else {
+		process->pid = (long) pid;
+	}
+#else
+	FILE *stream;
+	size_t count;
+	char buffer[IO_FILE_CHUNK_SIZE];
+
+	UNREF_PARAM(is_direct);
+
+	if(is_capture) {
+		stream = _popen(command.c_str(), "r");
+
+		if(!stream) {
+			delete process;
+			THROW_IO_EXC_W_MESS(command, IO_EXC_PIPE_FAILED);
+		}
+
+		while((count = fread(buffer, 1, IO_FILE_CHUNK_SIZE, stream)) > 0) {
+			process->output.append(buffer, count);
+		}
+		process->status = _pclose(stream);
+	} else {
+		process->status = system(command.c_str());
+	}
+	process->done = true;
+#endif
+	_processes.insert(std::pair<size_t, io_process_ptr>(++_process_handle, process));
+
+	TRACE_EVENT("-_io::spawn", TRACE_TYPE_INFORMATION);
+
+	return _process_handle;
+}
+
+std::string 
+_io::to_string(
+	bool verbose
+	)
+{
+	TRACE_EVENT("+_io::to_string", TRACE_TYPE_VERBOSE);
+
+	std::stringstream ss;
+	std::map<std::string, io_file_ptr>::iterator file = _files.begin();
+	std::map<std::string, io_reader_ptr>::iterator reader = _readers.begin();
+
+	ss << "Open files: " << _files.size() << ", Open readers: " << _readers.size()
+			<< ", Processes: " << _processes.size()
+			<< ", Stdout: " << IO_STDOUT_POLICY_STRING(_stdout_policy) << " (" << _stdout_buffer.size() 
+			<< "/" << _stdout_size << " bytes)";
+
+	if(_async) {
+		ss << ", " << _writer.to_string(verbose);
+	}
+
+	if(verbose) {
+
+		for(; file != _files.end(); ++file) {
+			ss << std::endl << "\t" << file->first << " (last use " << file->second->last_use << ")";
+		}
+
+		for(; reader != _readers.end(); ++reader) {
+			ss << std::endl << "\t" << reader->first << " (reading, last use " << reader->second->last_use << ")";
+		}
+	}
+
+	TRACE_EVENT("-_io::to_string", TRACE_TYPE_VERBOSE);
+
+	return ss.str();
+}
+
+bool 
+_io::write_file(
+	const std::string &path,
+	const char *data,
+	size_t length,
+	bool is_append,
+	bool is_binary,
+	bool is_trunc
+	)
+{
+	io_segment segment = { data, length };
+
+	return write_file(path, &segment, 1, is_append, is_binary, is_trunc);
+}
+
+bool 
+_io::write_file(
+	const std::string &path,
+	const io_segment *segments,
+	size_t count,
+	bool is_append,
+	bool is_binary,
+	bool is_trunc
+	)
+{
+	TRACE_EVENT("+_io::write_file", TRACE_TYPE_INFORMATION);
+
+	io_file_ptr file = NULL;
+	std::ios::openmode mode = std::ios::out
+			| (is_append ? std::ios::app : (std::ios::openmode) 0)
+			| (is_binary ? std::ios::binary : (std::ios::openmode) 0)
+			| (is_trunc ? std::ios::trunc : (std::ios::openmode) 0);
+	std::map<std::string, io_file_ptr>::iterator entry = _files.find(path);
+
+	if(entry != _files.end()
+			&& entry->second->mode == mode
+			&& is_append) {
+		file = entry->second;
+	} else {
+		file = _open_file(path, mode);
+	}
+
+	if(file) {
+		file->last_use = ++_tick;
+		_write_stream(file->stream, segments, count, false);
+	}
+
+	TRACE_EVENT("-_io::write_file", TRACE_TYPE_INFORMATION);
+
+	return file != NULL;
+}
+
+int 
+_io::wait(
+	size_t handle,
+	std::string &output
+	)
+{
+	TRACE_EVENT("+_io::wait", TRACE_TYPE_INFORMATION);
+
+	int status;
+	std::map<size_t, io_process_ptr>::iterator process = _processes.find(handle);
+
+	if(process == _processes.end()) {
+		TRACE_EVENT("Invalid process handle: " << handle, TRACE_TYPE_ERROR);
+		THROW_IO_EXC_W_MESS(handle, IO_EXC_INVAL_PROCESS);
+	}
+	_collect_process(process->second);
+	status = process->second->status;
+	output.swap(process->second->output);
+	delete process->second;
+	_processes.erase(process);
+
+	TRACE_EVENT("-_io::wait", TRACE_TYPE_INFORMATION);
+
+	return status;
+}
+
+void 
+_io::write_stdout(
+	const char *data,
+	size_t length
+	)
+{
+	io_segment segment = { data, length };
+
+	write_stdout(&segment, 1);
+}
+
+void 
+_io::write_stdout(
+	const io_segment *segments,
+	size_t count
+	)
+{
+	TRACE_EVENT("+_io::write_stdout", TRACE_TYPE_INFORMATION);
+
+	size_t i = 0, length = 0;
+	bool has_newline = false;
+
+	for(; i < count; ++i) {
+		length += segments[i].length;
+
+		if(_stdout_policy == IO_STDOUT_POLICY_LINE
+				&& !has_newline
+				&& segments[i].length
+				&& memchr(segments[i].data, '\n', segments[i].length)) {
+			has_newline = true;
+		}
+	}
+
+	if(_stdout_policy == IO_STDOUT_POLICY_UNBUFFERED) {
+		_write_stream(std::cout, segments, count, true);
+	} else {
+
+		if(_stdout_buffer.size() + length > _stdout_size) {
+			_flush_stdout_buffer();
+		}
+
+		if(length >= _stdout_size) {
+			_write_stream(std::cout, segments, count, false);
+		} else {
+
+			for(i = 0; i < count; ++i) {
+				_stdout_buffer.append(segments[i].data, segments[i].length);
+			}
+		}
+
+		if(has_newline) {
+			_flush_stdout_buffer();
+		}
+	}
+
+	TRACE_EVENT("-_io::write_stdout", TRACE_TYPE_INFORMATION);
+}
@@ -0,0 +1,525 @@
+/*
+ * io.h
+ * Copyright (C) 2013 David Jolly
+ * ----------------------
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef IO_H_
+#define IO_H_
+
+#include <fstream>
+#include <map>
+#include "io_type.h"
+#include "wrt.h"
+
+/*
+ * IO output segment
+ */
+typedef struct _io_segment {
+
+	/*
+	 * Segment data
+	 */
+	const char *data;
+	size_t length;
+
+} io_segment, *io_segment_ptr;
+
+/*
+ * IO file handle
+ */
+typedef struct _io_file {
+
+	/*
+	 * File buffer
+	 */
+	char *buffer;
+
+	/*
+	 * File last use tick
+	 */
+	size_t last_use;
+
+	/*
+	 * File open mode
+	 */
+	std::ios::openmode mode;
+
+	/*
+	 * File stream
+	 */
+	std::ofstream stream;
+
+} io_file, *io_file_ptr;
+
+/*
+ * IO streaming read handle
+ */
+typedef struct _io_reader {
+
+	/*
+	 * Reader buffer
+	 */
+	char *buffer;
+
+	/*
+	 * Reader last use tick
+	 */
+	size_t last_use;
+
+	/*
+	 * Reader open mode
+	 */
+	std::ios::openmode mode;
+
+	/*
+	 * Reader stream
+	 */
+	std::ifstream stream;
+
+} io_reader, *io_reader_ptr;
+
+/*
+ * IO process handle
+ */
+typedef struct _io_process {
+
+	/*
+	 * Process captured output
+	 */
+	bool capture;
+	int output_fd;
+	std::string output;
+
+	/*
+	 * Process identifier
+	 */
+	long pid;
+
+	/*
+	 * Process exit status
+	 */
+	bool done;
+	int status;
+
+} io_process, *io_process_ptr;
+
+/*
+ * IO class
+ * (keeps output files open between writes, flushing them at executor
+ * reset, program end, on request or when evicted from the cache;
+ * streaming reads hold their file open until end of file, until the
+ * file is overwritten or until evicted from the reader cache; stdout is
+ * buffered by line when attached to a terminal, by block otherwise;
+ * stdin is read through the shared stdio buffer, so reads interleave
+ * with std::cin;
+ * spawned processes are reaped when waited on or when cleared; in
+ * asynchronous mode writes are handed to a background writer, which is
+ * drained before any flush, close or read of a destination)
+ */
+typedef class _io {
+
+	public:
+
+		/*
+		 * IO constructor
+		 */
+		_io(void);
+
+		/*
+		 * IO constructor
+		 * (open file handles are not shared between io objects)
+		 * @param other io object reference
+		 */
+		_io(
+			const _io &other
+			);
+
+		/*
+		 * IO destructor
+		 */
+		virtual ~_io(void);
+
+		/*
+		 * IO assignment operator
+		 * (open file handles are not shared between io objects)
+		 * @param other io object reference
+		 * @return io object reference
+		 */
+		_io &operator=(
+			const _io &other
+			);
+
+		/*
+		 * Flush and close all open files and readers, waiting on any
+		 * outstanding processes
+		 */
+		void clear(void);
+
+		/*
+		 * Flush stdout and all open files
+		 */
+		void flush(void);
+
+		/*
+		 * Flush an open file at a given path
+		 * @param path file path string reference
+		 */
+		void flush(
+			const std::string &path
+			);
+
+		/*
+		 * Flush buffered stdout data
+		 */
+		void flush_stdout(void);
+
+		/*
+		 * Retrieve open file count
+		 * @return open file count
+		 */
+		size_t get_file_count(void);
+
+		/*
+		 * Retrieve count of files opened, including reopens of files
+		 * closed or evicted from the file and reader caches
+		 * @return opened file count
+		 */
+		size_t get_open_count(void);
+
+		/*
+		 * Retrieve outstanding process count
+		 * @return outstanding process count
+		 */
+		size_t get_process_count(void);
+
+		/*
+		 * Retrieve open reader count
+		 * @return open reader count
+		 */
+		size_t get_reader_count(void);
+
+		/*
+		 * Retrieve stdout buffering policy
+		 * @return stdout buffering policy type
+		 */
+		size_t get_stdout_policy(void);
+
+		/*
+		 * Retrieve stdout buffer size
+		 * @return stdout buffer size in bytes
+		 */
+		size_t get_stdout_size(void);
+
+		/*
+		 * Check if output is written asynchronously
+		 * @return true if asynchronous, false otherwise
+		 */
+		bool is_async(void);
+
+		/*
+		 * Check if a process captures its output
+		 * @param handle process handle
+		 * @return true if the process output is captured, false otherwise
+		 */
+		bool is_process_captured(
+			size_t handle
+			);
+
+		/*
+		 * Read the next line or chunk from a file at a given path
+		 * (lines keep their terminator, so only end of file yields
+		 * empty data; the reader is closed at end of file)
+		 * @param path file path string reference
+		 * @param data data string reference
+		 * @param is_binary true to read in binary mode, false otherwise
+		 * @param is_line true to read a line, false to read a chunk
+		 * @return true on success, false if the file could not be opened
+		 */
+		bool read_file(
+			const std::string &path,
+			std::string &data,
+			bool is_binary,
+			bool is_line
+			);
+
+		/*
+		 * Read data from stdin
+		 * @param data data string reference
+		 * @param length maximum data length in bytes (0 to read to end of input)
+		 * @param is_binary true to read in binary mode, false otherwise
+		 * @return true on success, false at end of input
+		 */
+		bool read_stdin(
+			std::string &data,
+			size_t length,
+			bool is_binary
+			);
+
+		/*
+		 * Read the next line from stdin
+		 * (the line terminator is dropped)
+		 * @param data line string reference
+		 * @param is_binary true to read in binary mode, false otherwise
+		 * @return true on success, false at end of input
+		 */
+		bool read_stdin_line(
+			std::string &data,
+			bool is_binary
+			);
+
+		/*
+		 * Set asynchronous output mode, draining any queued writes
+		 * @param is_async true to write on a background thread, false otherwise
+		 */
+		void set_async(
+			bool is_async
+			);
+
+		/*
+		 * Set stdout buffering policy, flushing any buffered data
+		 * @param policy stdout buffering policy type
+		 * @param size stdout buffer size in bytes (0 for default)
+		 */
+		void set_stdout_policy(
+			size_t policy,
+			size_t size
+			);
+
+		/*
+		 * Spawn a process running a given command
+		 * (the command runs through the shell unless direct, in which
+		 * case it is split into whitespace delimited arguments, honoring
+		 * quotes, and run from the search path)
+		 * @param command command string reference
+		 * @param is_capture true to capture process output, false otherwise
+		 * @param is_direct true to bypass the shell, false otherwise
+		 * @return process handle
+		 */
+		size_t spawn(
+			const std::string &command,
+			bool is_capture,
+			bool is_direct
+			);
+
+		/*
+		 * Retrieve string represenation
+		 * @param verbose verbose string status
+		 * @return string represenation
+		 */
+		std::string to_string(
+			bool verbose
+			);
+
+		/*
+		 * Wait for a spawned process to exit
+		 * @param handle process handle
+		 * @param output captured output string reference
+		 * @return process exit status
+		 */
+		int wait(
+			size_t handle,
+			std::string &output
+			);
+
+		/*
+		 * Write data to a file at a given path
+		 * @param path file path string reference
+		 * @param data data pointer
+		 * @param length data length in bytes
+		 * @param is_append true to append to file, false otherwise
+		 * @param is_binary true to write in binary mode, false otherwise
+		 * @param is_trunc true to truncate file, false otherwise
+		 * @return true on success, false if the file could not be opened
+		 */
+		bool write_file(
+			const std::string &path,
+			const char *data,
+			size_t length,
+			bool is_append,
+			bool is_binary,
+			bool is_trunc
+			);
+
+		/*
+		 * Write data segments to a file at a given path, in order
+		 * @param path file path string reference
+		 * @param segments segment array pointer
+		 * @param count segment count
+		 * @param is_append true to append to file, false otherwise
+		 * @param is_binary true to write in binary mode, false otherwise
+		 * @param is_trunc true to truncate file, false otherwise
+		 * @return true on success, false if the file could not be opened
+		 */
+		bool write_file(
+			const std::string &path,
+			const io_segment *segments,
+			size_t count,
+			bool is_append,
+			bool is_binary,
+			bool is_trunc
+			);
+
+		/*
+		 * Write data to stdout
+		 * @param data data pointer
+		 * @param length data length in bytes
+		 */
+		void write_stdout(
+			const char *data,
+			size_t length
+			);
+
+		/*
+		 * Write data segments to stdout, in order
+		 * @param segments segment array pointer
+		 * @param count segment count
+		 */
+		void write_stdout(
+			const io_segment *segments,
+			size_t count
+			);
+
+	protected:
+
+		/*
+		 * Close an open file at a given path
+		 * @param path file path string reference
+		 */
+		void _close_file(
+			const std::string &path
+			);
+
+		/*
+		 * Close an open reader at a given path
+		 * @param path file path string reference
+		 */
+		void _close_reader(
+			const std::string &path
+			);
+
+		/*
+		 * Wait for a process to exit, collecting any captured output
+		 * @param process process handle pointer
+		 */
+		void _collect_process(
+			io_process_ptr process
+			);
+
+		/*
+		 * Evict least recently used open file
+		 */
+		void _evict_file(void);
+
+		/*
+		 * Evict least recently used open reader
+		 */
+		void _evict_reader(void);
+
+		/*
+		 * Flush buffered stdout data without waiting on the writer
+		 */
+		void _flush_stdout_buffer(void);
+
+		/*
+		 * Open a file at a given path
+		 * @param path file path string reference
+		 * @param mode file open mode
+		 * @return file handle pointer, NULL if the file could not be opened
+		 */
+		io_file_ptr _open_file(
+			const std::string &path,
+			std::ios::openmode mode
+			);
+
+		/*
+		 * Open a reader at a given path
+		 * @param path file path string reference
+		 * @param mode file open mode
+		 * @return reader handle pointer, NULL if the file could not be opened
+		 */
+		io_reader_ptr _open_reader(
+			const std::string &path,
+			std::ios::openmode mode
+			);
+
+		/*
+		 * Write data segments to a stream, directly or through the writer
+		 * (segments are joined into a single writer entry)
+		 * @param stream stream reference
+		 * @param segments segment array pointer
+		 * @param count segment count
+		 * @param is_flush true to flush the stream after writing, false otherwise
+		 */
+		void _write_stream(
+			std::ostream &stream,
+			const io_segment *segments,
+			size_t count,
+			bool is_flush
+			);
+
+		/*
+		 * Asynchronous output mode
+		 */
+		bool _async;
+
+		/*
+		 * Open files
+		 */
+		std::map<std::string, io_file_ptr> _files;
+
+		/*
+		 * Opened file count
+		 */
+		size_t _open_count;
+
+		/*
+		 * Outstanding processes
+		 */
+		std::map<size_t, io_process_ptr> _processes;
+		size_t _process_handle;
+
+		/*
+		 * Open readers
+		 */
+		std::map<std::string, io_reader_ptr> _readers;
+
+		/*
+		 * Stdin line buffer
+		 */
+		char *_stdin_line;
+		size_t _stdin_line_size;
+
+		/*
+		 * Stdout buffer
+		 */
+		std::string _stdout_buffer;
+		size_t _stdout_policy;
+		size_t _stdout_size;
+
+		/*
+		 * File use tick
+		 */
+		size_t _tick;
+
+		/*
+		 * Background writer
+		 */
+		wrt _writer;
+
+} io, *io_ptr;
+
+#endif
@@ -0,0 +1,115 @@
+/*
+ * io_type.h
+ * Copyright (C) 2013 David Jolly
+ * ----------------------
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef IO_TYPE_H_
+#define IO_TYPE_H_
+
+#include <string>
+
+/*
+ * IO exception types
+ */
+enum {
+	IO_EXC_INVAL_PROCESS = 0,
+	IO_EXC_INVAL_STDOUT_POLICY,
+	IO_EXC_OUT_OF_MEMORY,
+	IO_EXC_PIPE_FAILED,
+};
+
+/*
+ * IO stdout buffering policy types
+ */
+enum {
+	IO_STDOUT_POLICY_BLOCK = 0,
+	IO_STDOUT_POLICY_LINE,
+	IO_STDOUT_POLICY_UNBUFFERED,
+};
+
+/*
+ * Max io types
+ */
+#define MAX_IO_EXC_TYPE IO_EXC_PIPE_FAILED
+#define MAX_IO_STDOUT_POLICY_TYPE IO_STDOUT_POLICY_UNBUFFERED
+
+/*
+ * IO file cache limits
+ */
+#define IO_FILE_BUFFER_SIZE 0x10000
+#define IO_FILE_CACHE_MAX 16
+#define IO_READER_CACHE_MAX 16
+
+/*
+ * IO streaming read chunk size
+ */
+#define IO_FILE_CHUNK_SIZE 0x1000
+
+/*
+ * IO stdin buffer size
+ */
+#define IO_STDIN_BUFFER_SIZE 0x10000
+
+/*
+ * IO stdout buffer size
+ */
+#define IO_STDOUT_BUFFER_SIZE 0x2000
+
+/*
+ * IO process spawning
+ */
+#define IO_EXEC_SHELL "/bin/sh"
+#define IO_EXEC_SHELL_FLAG "-c"
+#define IO_EXEC_STATUS_NOT_FOUND 127
+#define IO_EXEC_STATUS_SIGNAL_BASE 128
+
+/*
+ * IO strings
+ */
+static const std::string IO_EXC_STR[] = {
+	"Invalid process handle",
+	"Invalid stdout buffering policy",
+	"Failed to allocate file handle",
+	"Failed to create process pipe",
+};
+
+static const std::string IO_STDOUT_POLICY_STR[] = {
+	"block", "line", "unbuffered",
+};
+
+/*
+ * IO string lookup macros
+ */
+#define IO_EXC_STRING(_T_) (_T_ > MAX_IO_EXC_TYPE ? "Unknown io exception type" : IO_EXC_STR[_T_])
+#define IO_STDOUT_POLICY_STRING(_T_) (_T_ > MAX_IO_STDOUT_POLICY_TYPE ? "Unknown stdout policy type" : IO_STDOUT_POLICY_STR[_T_])
+
+/*
+ * IO exception macros
+ */
+#define THROW_IO_EXC(_T_) {\
+	std::stringstream ss;\
+	ss << IO_EXC_STRING(_T_);\
+	throw std::runtime_error(ss.str().c_str());\
+	}
+	
+#define THROW_IO_EXC_W_MESS(_M_, _T_) {\
+	std::stringstream ss;\
+	ss << IO_EXC_STRING(_T_) << ": " << _M_;\
+	throw std::runtime_error(ss.str().c_str());\
+	}
+
+#endif
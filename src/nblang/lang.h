@@ -99,7 +99,8 @@ enum {
 };
 
 enum {
-	CONSTANT_TYPE_EMPTY = 0,
+	CONSTANT_TYPE_CLOCK = 0,
+	CONSTANT_TYPE_EMPTY,
 	CONSTANT_TYPE_ENDLINE,
 	CONSTANT_TYPE_FALSE,
 	CONSTANT_TYPE_NULL,
@@ -117,9 +118,19 @@ enum {
 	CONVERSION_OPERATOR_TYPE_FLOAT,
 };
 
+enum {
+	EXEC_OPERATOR_TYPE_ASYNC = 0,
+	EXEC_OPERATOR_TYPE_CAPTURE,
+	EXEC_OPERATOR_TYPE_DIRECT,
+	EXEC_OPERATOR_TYPE_WAIT,
+};
+
 enum {
 	FILE_STREAM_OPERATOR_TYPE_APPEND = 0,
 	FILE_STREAM_OPERATOR_TYPE_BIN,
+	FILE_STREAM_OPERATOR_TYPE_CHUNK,
+	FILE_STREAM_OPERATOR_TYPE_EOF,
+	FILE_STREAM_OPERATOR_TYPE_LINE,
 	FILE_STREAM_OPERATOR_TYPE_TRUNC,
 };
 
@@ -143,6 +154,7 @@ enum {
 
 enum {
 	LOGICAL_OPERATOR_TYPE_CEILING = 0,
+	LOGICAL_OPERATOR_TYPE_ELAPSED,
 	LOGICAL_OPERATOR_TYPE_FLOOR,
 	LOGICAL_OPERATOR_TYPE_RANDOM,
 	LOGICAL_OPERATOR_TYPE_ROUND,
@@ -193,6 +205,7 @@ enum {
 	TOKEN_TYPE_CONSTANT,
 	TOKEN_TYPE_CONTROL,
 	TOKEN_TYPE_CONVERSION_OPERATOR,
+	TOKEN_TYPE_EXEC_OPERATOR,
 	TOKEN_TYPE_FILE_STREAM_OPERATOR,
 	TOKEN_TYPE_FLOAT,
 	TOKEN_TYPE_IDENTIFIER,
@@ -227,6 +240,7 @@ enum {
 #define MAX_CONSTANT_TYPE CONSTANT_TYPE_TRUE
 #define MAX_CONTROL_TYPE CONTROL_TYPE_EXIT
 #define MAX_CONVERSION_OPERATOR_TYPE CONVERSION_OPERATOR_TYPE_FLOAT
+#define MAX_EXEC_OPERATOR_TYPE EXEC_OPERATOR_TYPE_WAIT
 #define MAX_FILE_STREAM_OPERATOR_TYPE FILE_STREAM_OPERATOR_TYPE_TRUNC
 #define MAX_IO_OPERATOR_TYPE IO_OPERATOR_TYPE_OUT
 #define MAX_IN_LIST_OPERATOR_TYPE IN_LIST_OPERATOR_TYPE_PUSH_FRONT
@@ -281,7 +295,7 @@ static const std::string CONDITIONAL_TYPE_STR[] = {
 };
 
 static const std::string CONSTANT_TYPE_STR[] = {
-	"empty", "endl", "false", "null", "true",
+	"clock", "empty", "endl", "false", "null", "true",
 };
 
 static const std::string CONTROL_TYPE_STR[] = {
@@ -292,8 +306,12 @@ static const std::string CONVERSION_OPERATOR_TYPE_STR[] = {
 	"int", "float",
 };
 
+static const std::string EXEC_OPERATOR_TYPE_STR[] = {
+	"async", "capture", "direct", "wait",
+};
+
 static const std::string FILE_STREAM_OPERATOR_TYPE_STR[] = {
-	"append", "bin", "trunc",
+	"append", "bin", "chunk", "eof", "line", "trunc",
 };
 
 static const std::string IO_OPERATOR_TYPE_STR[] = {
@@ -309,7 +327,7 @@ static const std::string ITERATOR_OPERATOR_TYPE_STR[] = {
 };
 
 static const std::string LOGICAL_OPERATOR_TYPE_STR[] = {
-	"ceil", "flr", "rdm", "rnd", "shl", "shr",
+	"ceil", "elap", "flr", "rdm", "rnd", "shl", "shr",
 };
 
 static const std::string OUT_LIST_OPERATOR_TYPE_STR[] = {
@@ -327,7 +345,7 @@ static const std::string SYMBOL_TYPE_STR[] = {
 
 static const std::string TOKEN_TYPE_STR[] = {
 	"access", "argument", "assignment", "binary", "call", "comparator", "conditional", "conditional seperator", "constant", "control", 
-	"conversion", "file stream", "float", "identifier", "io", "in list", "integer", "iterator", "logical", 
+	"conversion", "exec", "file stream", "float", "identifier", "io", "in list", "integer", "iterator", "logical", 
 	"out list", "string", "stream", "symbol", "using",
 };
 
@@ -350,6 +368,7 @@ static const size_t TYPE_COUNT_LOOKUP[] = {
 	MAX_CONSTANT_TYPE,
 	MAX_CONTROL_TYPE,
 	MAX_CONVERSION_OPERATOR_TYPE,
+	MAX_EXEC_OPERATOR_TYPE,
 	MAX_FILE_STREAM_OPERATOR_TYPE,
 	0,
 	0,
@@ -377,6 +396,7 @@ static const std::string *TYPE_STRING_LOOKUP[] = {
 	CONSTANT_TYPE_STR,
 	CONTROL_TYPE_STR,
 	CONVERSION_OPERATOR_TYPE_STR,
+	EXEC_OPERATOR_TYPE_STR,
 	FILE_STREAM_OPERATOR_TYPE_STR,
 	NULL,
 	NULL,
@@ -450,6 +470,11 @@ static const std::set<std::string> CONVERSION_OPERATOR_TYPE_SET(
 	CONVERSION_OPERATOR_TYPE_STR + MAX_CONVERSION_OPERATOR_TYPE + 1
 	);
 
+static const std::set<std::string> EXEC_OPERATOR_TYPE_SET(
+	EXEC_OPERATOR_TYPE_STR,
+	EXEC_OPERATOR_TYPE_STR + MAX_EXEC_OPERATOR_TYPE + 1
+	);
+
 static const std::set<std::string> FILE_STREAM_OPERATOR_TYPE_SET(
 	FILE_STREAM_OPERATOR_TYPE_STR,
 	FILE_STREAM_OPERATOR_TYPE_STR + MAX_FILE_STREAM_OPERATOR_TYPE + 1
@@ -526,6 +551,7 @@ static const std::set<std::string> USING_TYPE_SET(
 #define CONSTANT_TYPE_STRING(_T_) (_T_ > MAX_CONSTANT_TYPE ? UNKNOWN_TYPE : CONSTANT_TYPE_STR[_T_])
 #define CONTROL_TYPE_STRING(_T_) (_T_ > MAX_CONTROL_TYPE ? UNKNOWN_TYPE : CONTROL_TYPE_STR[_T_])
 #define CONVERSION_OPERATOR_TYPE_STRING(_T_) (_T_ > MAX_CONVERSION_OPERATOR_TYPE ? UNKNOWN_TYPE : CONVERSION_OPERATOR_TYPE_STR[_T_])
+#define EXEC_OPERATOR_TYPE_STRING(_T_) (_T_ > MAX_EXEC_OPERATOR_TYPE ? UNKNOWN_TYPE : EXEC_OPERATOR_TYPE_STR[_T_])
 #define FILE_STREAM_OPERATOR_TYPE_STRING(_T_) (_T_ > MAX_FILE_STREAM_OPERATOR_TYPE ? UNKNOWN_TYPE : FILE_STREAM_OPERATOR_TYPE_STR[_T_])
 #define IO_OPERATOR_TYPE_STRING(_T_) (_T_ > MAX_IO_OPERATOR_TYPE ? UNKNOWN_TYPE : IO_OPERATOR_TYPE_STR[_T_])
 #define IN_LIST_OPERATOR_TYPE_STRING(_T_) (_T_ > MAX_IN_LIST_OPERATOR_TYPE ? UNKNOWN_TYPE : IN_LIST_OPERATOR_TYPE_STR[_T_])
@@ -553,6 +579,7 @@ static const std::set<std::string> USING_TYPE_SET(
 #define IS_CONSTANT_TYPE(_S_) (CONSTANT_TYPE_SET.find(_S_) != CONSTANT_TYPE_SET.end())
 #define IS_CONTROL_TYPE(_S_) (CONTROL_TYPE_SET.find(_S_) != CONTROL_TYPE_SET.end())
 #define IS_CONVERSION_OPERATOR_TYPE(_S_) (CONVERSION_OPERATOR_TYPE_SET.find(_S_) != CONVERSION_OPERATOR_TYPE_SET.end())
+#define IS_EXEC_OPERATOR_TYPE(_S_) (EXEC_OPERATOR_TYPE_SET.find(_S_) != EXEC_OPERATOR_TYPE_SET.end())
 #define IS_FILE_STREAM_OPERATOR_TYPE(_S_) (FILE_STREAM_OPERATOR_TYPE_SET.find(_S_) != FILE_STREAM_OPERATOR_TYPE_SET.end())
 #define IS_IO_OPERATOR_TYPE(_S_) (IO_OPERATOR_TYPE_SET.find(_S_) != IO_OPERATOR_TYPE_SET.end())
 #define IS_IN_LIST_OPERATOR_TYPE(_S_) (IN_LIST_OPERATOR_TYPE_SET.find(_S_) != IN_LIST_OPERATOR_TYPE_SET.end())
@@ -24,7 +24,8 @@
 
 //#define LEXER_BASE_TRACING
 #ifndef LEXER_BASE_TRACING
-#define TRACE_EVENT(_M_, _T_)
+#define TRACE_SUBSYSTEM TRC_SUBSYSTEM_LEXER
+#include "trace.h"
 #else
 #define TRACE_HEADER "lexer_base"
 #include "trace.h"
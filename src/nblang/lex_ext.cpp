@@ -26,7 +26,8 @@
 
 //#define LEXER_EXT_TRACING
 #ifndef LEXER_EXT_TRACING
-#define TRACE_EVENT(_M_, _T_)
+#define TRACE_SUBSYSTEM TRC_SUBSYSTEM_LEXER
+#include "trace.h"
 #else
 #define TRACE_HEADER "lexer_ext"
 #include "trace.h"
@@ -82,6 +83,8 @@ lex_enum_alpha(
 				token.set_as_token(TOKEN_TYPE_CONTROL, INVALID_TYPE);
 			} else if(IS_CONVERSION_OPERATOR_TYPE(token.get_text())) {
 				token.set_as_token(TOKEN_TYPE_CONVERSION_OPERATOR, INVALID_TYPE);
+			} else if(IS_EXEC_OPERATOR_TYPE(token.get_text())) {
+				token.set_as_token(TOKEN_TYPE_EXEC_OPERATOR, INVALID_TYPE);
 			} else if(IS_FILE_STREAM_OPERATOR_TYPE(token.get_text())) {
 				token.set_as_token(TOKEN_TYPE_FILE_STREAM_OPERATOR, INVALID_TYPE);
 			} else if(IS_IN_LIST_OPERATOR_TYPE(token.get_text())) {
@@ -103,6 +106,8 @@ lex_enum_alpha(
 			if(!IS_TYPE_T(token, TOKEN_TYPE_IDENTIFIER)) {
 				token.set_as_token(token.get_type(), lang_find_subtype(token.get_text(), token.get_type()));
 				token.set_value(std::string());
+			} else {
+				token.set_atom(atm::intern(token.get_text()));
 			}
 		} else {
 			TRACE_EVENT("Invalid alpha symbol: " << base->to_string(true), TRACE_TYPE_ERROR);
@@ -20,11 +20,20 @@
 #ifndef LIST_H_
 #define LIST_H_
 
-#include "link.h"
+#include <algorithm>
+#include <cstring>
+#include <sstream>
+#include <stdexcept>
+#include <vector>
 #include "list_type.h"
 
 /*
  * List template class
+ * (value pointers are held in fixed capacity chunks, so indexed access
+ * only searches the chunk offsets and insertion only shifts pointers in
+ * one chunk; values never move, so references returned by get() stay
+ * valid until the value is removed; chunk offsets are recalculated
+ * lazily, on the next indexed access)
  */
 template <class T>
 class _list {
@@ -104,44 +113,17 @@ class _list {
 			size_t index
 			);
 
-		/*
-		 * Retrieve link at a given index
-		 * @param index link object index
-		 * @return link object pointer
-		 */
-		_link<T> *get_link(
-			size_t index
-			);
-
 		/*
 		 * Retrieve list value at end of list
-		 * @param index list value index
 		 * @return list value reference
 		 */
-		T &get_back(
-			size_t index
-			);
-
-		/*
-		 * Retrieve link at end of list
-		 * @return link object pointer
-		 */
-		_link<T> *get_back_link(void);
+		T &get_back(void);
 
 		/*
 		 * Retrieve list value at begining of list
-		 * @param index list value index
 		 * @return list value reference
 		 */
-		T &get_front(
-			size_t index
-			);
-
-		/*
-		 * Retrieve link at begining of list
-		 * @return link object pointer
-		 */
-		_link<T> *get_front_link(void);
+		T &get_front(void);
 
 		/*
 		 * Retrieve link count
@@ -165,6 +147,17 @@ class _list {
 			size_t index
 			);
 
+		/* 
+		 * Insert allocated link value at a given index
+		 * (the value is not copied; the list owns it once inserted)
+		 * @param value link value pointer
+		 * @param index link index
+		 */
+		void insert(
+			T *value,
+			size_t index
+			);
+
 		/*
 		 * Remove link at a given index
 		 * @param index link index
@@ -188,6 +181,17 @@ class _list {
 		 */
 		void remove_front(void);
 
+		/*
+		 * Move all links from another list into list at a given index
+		 * (link values are moved, not copied, and the other list is left empty)
+		 * @param other list object reference
+		 * @param index link index
+		 */
+		void splice(
+			_list<T> &other,
+			size_t index
+			);
+
 		/*
 		 * Retrieve string represenation
 		 * @param verbose verbose string status
@@ -200,60 +204,132 @@ class _list {
 	protected:
 
 		/*
-		 * Copy list from link
-		 * @param front link to copy from
+		 * List chunk
+		 */
+		typedef struct {
+
+			/*
+			 * Chunk value count
+			 */
+			size_t count;
+
+			/*
+			 * Chunk values
+			 */
+			T *value[LIST_CHUNK_SIZE];
+
+		} _chunk;
+
+		/*
+		 * Copy list from another list
+		 * @param other list object reference
 		 */
 		void _copy_helper(
-			_link<T> *front
+			const _list<T> &other
 			);
 
 		/*
-		 * List back link
+		 * Allocate an empty chunk at a given chunk index
+		 * @param chunk chunk index
+		 * @return chunk object pointer
 		 */
-		_link<T> *_back;
+		_chunk *_create_chunk(
+			size_t chunk
+			);
+
+		/*
+		 * Retrieve chunk index holding a given link index
+		 * @param index link index
+		 * @return chunk index
+		 */
+		size_t _find_chunk(
+			size_t index
+			);
+
+		/*
+		 * Mark chunk offsets as stale from a given chunk index
+		 * @param chunk chunk index
+		 */
+		void _invalidate_offsets(
+			size_t chunk
+			);
 
 		/*
-		 * List front link
+		 * Split a chunk at a given chunk position, moving the tail value
+		 * pointers into a new chunk
+		 * @param chunk chunk index
+		 * @param position chunk position
 		 */
-		_link<T> *_front;
+		void _split_chunk(
+			size_t chunk,
+			size_t position
+			);
+
+		/*
+		 * Recalculate stale chunk offsets up to the chunk holding a given link index
+		 * @param index link index
+		 */
+		void _validate_offsets(
+			size_t index
+			);
+
+		/*
+		 * List chunk last found
+		 */
+		size_t _cached_chunk;
+
+		/*
+		 * List chunk offsets
+		 */
+		std::vector<size_t> _chunk_offset;
+
+		/*
+		 * List chunks
+		 */
+		std::vector<_chunk *> _chunks;
 
 		/*
 		 * List size
 		 */
 		size_t _size;
 
+		/*
+		 * List chunk count with valid offsets
+		 */
+		size_t _valid_chunk;
+
 };
 
 template <class T>
-_list<T>::_list(void)
+_list<T>::_list(void) :
+	_cached_chunk(0),
+	_size(0),
+	_valid_chunk(0)
 {
-	_back = NULL;
-	_front = NULL;
-	_size = 0;
 	clear();
 }
 
 template <class T>
 _list<T>::_list(
 	const T &value
-	)
+	) :
+		_cached_chunk(0),
+		_size(0),
+		_valid_chunk(0)
 {
-	_back = NULL;
-	_front = NULL;
-	_size = 0;
 	clear(value);
 }
 
 template <class T>
 _list<T>::_list(
 	const _list<T> &other
-	)
+	) :
+		_cached_chunk(0),
+		_size(0),
+		_valid_chunk(0)
 {
-	_back = NULL;
-	_front = NULL;
-	_size = 0;
 	clear();
-	_copy_helper(other._front);
+	_copy_helper(other);
 }
 
 template <class T>
@@ -269,7 +345,7 @@ _list<T>::operator=(
 {
 	if(this != &other) {
 		clear();
-		_copy_helper(other._front);
+		_copy_helper(other);
 	}
 
 	return *this;
@@ -277,38 +353,102 @@ _list<T>::operator=(
 
 template <class T> void 
 _list<T>::_copy_helper(
-	_link<T> *front
+	const _list<T> &other
 	)
 {
-	_link<T> *link = front, *new_link = NULL, *prev_link = NULL;
+	_chunk *entry = NULL, *other_entry = NULL;
+	size_t chunk = 0, position;
 
-	_back = NULL;
-	_front = NULL;
-	_size = 0;
+	for(; chunk < other._chunks.size(); ++chunk) {
+		entry = _create_chunk(chunk);
+		other_entry = other._chunks.at(chunk);
 
-	while(link) {
-		new_link = new _link<T>(*front);
+		for(position = 0; position < other_entry->count; ++position) {
+			entry->value[position] = new T(*other_entry->value[position]);
 
-		if(!new_link) {
-			THROW_LIST_EXC(LIST_EXC_OUT_OF_MEMORY);
+			if(!entry->value[position]) {
+				THROW_LIST_EXC(LIST_EXC_OUT_OF_MEMORY);
+			}
+			++entry->count;
+			++_size;
 		}
+	}
+}
 
-		if(!_size) {
-			_front = new_link;
-		}
+template <class T> typename _list<T>::_chunk *
+_list<T>::_create_chunk(
+	size_t chunk
+	)
+{
+	_chunk *entry = new _chunk;
 
-		if(prev_link) {
-			prev_link->set_next(new_link);
-			new_link->set_previous(prev_link);
-		} else {
-			new_link->set_previous(NULL);
+	if(!entry) {
+		THROW_LIST_EXC(LIST_EXC_OUT_OF_MEMORY);
+	}
+	entry->count = 0;
+	_chunks.insert(_chunks.begin() + chunk, entry);
+	_chunk_offset.insert(_chunk_offset.begin() + chunk, 0);
+	_invalidate_offsets(chunk);
+
+	return entry;
+}
+
+template <class T> size_t 
+_list<T>::_find_chunk(
+	size_t index
+	)
+{
+	if(index >= _size) {
+		THROW_LIST_EXC_W_MESS(index, LIST_EXC_INVALID_LINK_INDEX);
+	}
+	_validate_offsets(index);
+
+	if(_cached_chunk >= _valid_chunk
+			|| index < _chunk_offset.at(_cached_chunk)
+			|| index >= (_chunk_offset.at(_cached_chunk) + _chunks.at(_cached_chunk)->count)) {
+		_cached_chunk = (std::upper_bound(_chunk_offset.begin(), _chunk_offset.begin() + _valid_chunk, index) 
+			- _chunk_offset.begin()) - 1;
+	}
+
+	return _cached_chunk;
+}
+
+template <class T> void 
+_list<T>::_invalidate_offsets(
+	size_t chunk
+	)
+{
+	_valid_chunk = std::min(_valid_chunk, chunk);
+}
+
+template <class T> void 
+_list<T>::_split_chunk(
+	size_t chunk,
+	size_t position
+	)
+{
+	_chunk *entry = _chunks.at(chunk), *tail = NULL;
+
+	tail = _create_chunk(chunk + 1);
+	tail->count = entry->count - position;
+	std::memcpy(tail->value, entry->value + position, tail->count * sizeof(T *));
+	entry->count = position;
+}
+
+template <class T> void 
+_list<T>::_validate_offsets(
+	size_t index
+	)
+{
+	for(; _valid_chunk < _chunks.size(); ++_valid_chunk) {
+
+		if(_valid_chunk
+				&& (_chunk_offset.at(_valid_chunk - 1) + _chunks.at(_valid_chunk - 1)->count) > index) {
+			break;
 		}
-		new_link->set_next(NULL);
-		link = link->get_next();
-		prev_link = new_link;
-		++_size;
+		_chunk_offset.at(_valid_chunk) = _valid_chunk ? (_chunk_offset.at(_valid_chunk - 1) 
+			+ _chunks.at(_valid_chunk - 1)->count) : 0;
 	}
-	_back = new_link;
 }
 
 template <class T> void 
@@ -331,9 +471,6 @@ template <class T> void
 _list<T>::clear(void)
 {
 	remove_all();
-	_back = NULL;
-	_front = NULL;
-	_size = 0;
 }
 
 template <class T> void 
@@ -350,62 +487,29 @@ _list<T>::get(
 	size_t index
 	)
 {
-	return get_link(index)->get();
-}
-
-template <class T> _link<T> *
-_list<T>::get_link(
-	size_t index
-	)
-{
-	size_t position = 0;
-	_link<T> *link = _front;
-
-	if(index >= _size) {
-		THROW_LIST_EXC_W_MESS(index, LIST_EXC_INVALID_LINK_INDEX);
-	}
+	size_t chunk = _find_chunk(index);
 
-	while(position++ < index) {
-		link = link->get_next();
-	}
-
-	return link;
+	return *_chunks.at(chunk)->value[index - _chunk_offset.at(chunk)];
 }
 
 template <class T> T &
-_list<T>::get_back(
-	size_t index
-	)
-{
-	return get_back_link(index)->get();
-}
-
-template <class T> _link<T> *
-_list<T>::get_back_link(void)
+_list<T>::get_back(void)
 {
-	if(!_back) {
+	if(!_size) {
 		THROW_LIST_EXC(LIST_EXC_INVALID_BACK_LINK);
 	}
 
-	return _back;
+	return get(_size - 1);
 }
 
 template <class T> T &
-_list<T>::get_front(
-	size_t index
-	)
-{
-	return get_front_link(index)->get();
-}
-
-template <class T> _link<T> *
-_list<T>::get_front_link(void)
+_list<T>::get_front(void)
 {
-	if(!_front) {
+	if(!_size) {
 		THROW_LIST_EXC(LIST_EXC_INVALID_FRONT_LINK);
 	}
 
-	return _front;
+	return get(0);
 }
 
 template <class T> size_t 
@@ -426,134 +530,116 @@ _list<T>::insert(
 	size_t index
 	)
 {
-	size_t position = 0;
-	_link<T> *link = _front, *new_link = NULL;
+	T *new_value = new T(value);
 
-	if(index > _size) {
-		THROW_LIST_EXC_W_MESS(index, LIST_EXC_INVALID_LINK_INDEX);
-	}
-	new_link = new _link<T>(value);
-
-	if(!new_link) {
+	if(!new_value) {
 		THROW_LIST_EXC(LIST_EXC_OUT_OF_MEMORY);
 	}
 
-	if(!index) {
-
-		if(!link) {
-			new_link->set_next(NULL);
-			new_link->set_previous(NULL);
-			_back = new_link;
-			_front = new_link;
-		} else {
-			new_link->set_next(_front);
-			new_link->set_previous(NULL);
-			_front->set_previous(new_link);
-			_front = new_link;
-		}
-	} else if(index < _size) {
-
-		while(++position < index) {
-
-			if(!link->has_next()) {
-				THROW_LIST_EXC_W_MESS(index, LIST_EXC_INVALID_LINK_INDEX);
-			}
-			link = link->get_next();
-		}
-		new_link->set_next(link->get_next());
-		new_link->set_previous(link);
-		link->get_next()->set_previous(new_link);
-		link->set_next(new_link);
-	} else {
-		new_link->set_next(NULL);
-		new_link->set_previous(_back);
-		_back->set_next(new_link);
-		_back = new_link;
+	try {
+		insert(new_value, index);
+	} catch(...) {
+		delete new_value;
+		throw;
 	}
-	++_size;
 }
 
 template <class T> void 
-_list<T>::remove(
+_list<T>::insert(
+	T *value,
 	size_t index
 	)
 {
-	size_t position = 0;
-	_link<T> *link = _front, *old_link = NULL;
+	_chunk *entry = NULL;
+	size_t chunk, position;
 
 	if(index > _size) {
 		THROW_LIST_EXC_W_MESS(index, LIST_EXC_INVALID_LINK_INDEX);
 	}
 
-	if(link) {
+	if(index == _size) {
 
-		if(!index) {
-			old_link = _front;
-
-			if(_front->has_next()) {
-				_front = _front->get_next();
-				_front->set_previous(NULL);
-			} else {
-				_front = NULL;
-			}
-
-			if(_size == 1) {
-				_back = NULL;
-			}
-		} else if(index < _size) {
-
-			while(position++ < index) {
-
-				if(!link->has_next()) {
-					THROW_LIST_EXC_W_MESS(index, LIST_EXC_INVALID_LINK_INDEX);
-				}
-				link = link->get_next();
-			}
-		
-			if(link->has_next()) {
-				old_link = link->get_next();
-			}
+		if(_chunks.empty()
+				|| _chunks.back()->count == LIST_CHUNK_SIZE) {
+			_create_chunk(_chunks.size());
+		}
+		chunk = _chunks.size() - 1;
+		position = _chunks.back()->count;
+	} else {
+		chunk = _find_chunk(index);
+		position = index - _chunk_offset.at(chunk);
 
-			if(old_link->has_next()) {
-				link->set_next(old_link->get_next());
-				link->get_next()->set_previous(link);
-			} else {
-				link->set_next(NULL);
-			}
-		} else {
-			old_link = _back;
+		if(_chunks.at(chunk)->count == LIST_CHUNK_SIZE) {
 
-			if(_back->has_previous()) {
-				_back = _back->get_previous();
-				_back->set_next(NULL);
+			if(!position) {
+				_create_chunk(chunk);
 			} else {
-				_back = NULL;
-			}
+				_split_chunk(chunk, LIST_CHUNK_SIZE / 2);
 
-			if(_size == 1) {
-				_front = NULL;
+				if(position >= (LIST_CHUNK_SIZE / 2)) {
+					position -= (LIST_CHUNK_SIZE / 2);
+					++chunk;
+				}
 			}
 		}
 	}
+	entry = _chunks.at(chunk);
+	std::memmove(entry->value + position + 1, entry->value + position, (entry->count - position) * sizeof(T *));
+	entry->value[position] = value;
+	++entry->count;
+	++_size;
+	_invalidate_offsets(chunk + 1);
+}
 
-	if(old_link) {
-		delete old_link;
-		--_size;
+template <class T> void 
+_list<T>::remove(
+	size_t index
+	)
+{
+	_chunk *entry = NULL;
+	size_t chunk = _find_chunk(index), position;
+
+	entry = _chunks.at(chunk);
+	position = index - _chunk_offset.at(chunk);
+	delete entry->value[position];
+	--entry->count;
+	--_size;
+	std::memmove(entry->value + position, entry->value + position + 1, (entry->count - position) * sizeof(T *));
+
+	if(!entry->count) {
+		delete entry;
+		_chunks.erase(_chunks.begin() + chunk);
+		_chunk_offset.erase(_chunk_offset.begin() + chunk);
+	} else {
+		++chunk;
 	}
+	_invalidate_offsets(chunk);
 }
 
 template <class T> void 
 _list<T>::remove_all(void)
 {
-	while(has_links()) {
-		remove_front();
+	size_t position;
+	typename std::vector<_chunk *>::iterator chunk = _chunks.begin();
+
+	for(; chunk != _chunks.end(); ++chunk) {
+
+		for(position = 0; position < (*chunk)->count; ++position) {
+			delete (*chunk)->value[position];
+		}
+		delete *chunk;
 	}
+	_chunks.clear();
+	_chunk_offset.clear();
+	_cached_chunk = 0;
+	_valid_chunk = 0;
+	_size = 0;
 }
 
 template <class T> void 
 _list<T>::remove_back(void)
 {
-	remove(_size);
+	remove(_size - 1);
 }
 
 template <class T> void 
@@ -562,6 +648,43 @@ _list<T>::remove_front(void)
 	remove(0);
 }
 
+template <class T> void 
+_list<T>::splice(
+	_list<T> &other,
+	size_t index
+	)
+{
+	size_t chunk;
+
+	if(index > _size) {
+		THROW_LIST_EXC_W_MESS(index, LIST_EXC_INVALID_LINK_INDEX);
+	}
+
+	if(this != &other
+			&& other._size) {
+
+		if(index == _size) {
+			chunk = _chunks.size();
+		} else {
+			chunk = _find_chunk(index);
+
+			if(index > _chunk_offset.at(chunk)) {
+				_split_chunk(chunk, index - _chunk_offset.at(chunk));
+				++chunk;
+			}
+		}
+		_chunks.insert(_chunks.begin() + chunk, other._chunks.begin(), other._chunks.end());
+		_chunk_offset.insert(_chunk_offset.begin() + chunk, other._chunks.size(), 0);
+		_size += other._size;
+		_invalidate_offsets(chunk);
+		other._chunks.clear();
+		other._chunk_offset.clear();
+		other._cached_chunk = 0;
+		other._valid_chunk = 0;
+		other._size = 0;
+	}
+}
+
 template <class T> std::string 
 _list<T>::to_string(
 	bool verbose
@@ -569,17 +692,11 @@ _list<T>::to_string(
 {
 	size_t i = 0;
 	std::stringstream ss;
-	_link<T> *link = _front;
 
 	if(_size) {
 
 		for(; i < _size; ++i) {
-			ss << link->to_string(verbose) << (link == _front ? " (FRONT)" : "") << (link == _back ? " (BACK)" : "") << std::endl << std::endl;
-
-			if(!link->has_next()) {
-				break;
-			}
-			link = link->get_next();
+			ss << get(i).to_string(verbose) << (!i ? " (FRONT)" : "") << ((i == (_size - 1)) ? " (BACK)" : "") << std::endl << std::endl;
 		}
 	} else {
 		ss << "Empty list" << std::endl;
@@ -588,4 +705,4 @@ _list<T>::to_string(
 	return ss.str();
 }
 
-#endif
\ No newline at end of file
+#endif
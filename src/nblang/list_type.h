@@ -37,6 +37,11 @@ enum {
  */
 #define MAX_LIST_EXC_TYPE LIST_EXC_OUT_OF_MEMORY
 
+/*
+ * List chunk capacity
+ */
+#define LIST_CHUNK_SIZE 64
+
 /*
  * List strings
  */
@@ -0,0 +1,234 @@
+/*
+ * mem.cpp
+ * Copyright (C) 2013 David Jolly
+ * ----------------------
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <cstring>
+#include <iomanip>
+#include <sstream>
+#include <stdexcept>
+#include "mem.h"
+
+//#define MEM_TRACING
+#ifndef MEM_TRACING
+#define TRACE_SUBSYSTEM TRC_SUBSYSTEM_EXECUTOR
+#include "trace.h"
+#else
+#define TRACE_HEADER "mem"
+#include "trace.h"
+#endif
+
+_mem::_mem(void) :
+	_enabled(false),
+	_limit(0)
+{
+	TRACE_EVENT("+_mem::_mem", TRACE_TYPE_INFORMATION);
+
+	clear();
+
+	TRACE_EVENT("-_mem::_mem", TRACE_TYPE_INFORMATION);
+}
+
+_mem::_mem(
+	const _mem &other
+	) :
+		_enabled(other._enabled),
+		_limit(other._limit),
+		_peak(other._peak),
+		_ticks(other._ticks)
+{
+	TRACE_EVENT("+_mem::_mem", TRACE_TYPE_INFORMATION);
+
+	memcpy(_regions, other._regions, sizeof(size_t) * (MAX_MEM_REGION_TYPE + 1));
+	memcpy(_region_peaks, other._region_peaks, sizeof(size_t) * (MAX_MEM_REGION_TYPE + 1));
+
+	TRACE_EVENT("-_mem::_mem", TRACE_TYPE_INFORMATION);
+}
+
+_mem::~_mem(void)
+{
+	TRACE_EVENT("+_mem::~_mem", TRACE_TYPE_INFORMATION);
+	TRACE_EVENT("-_mem::~_mem", TRACE_TYPE_INFORMATION);
+}
+
+_mem &
+_mem::operator=(
+	const _mem &other
+	)
+{
+	TRACE_EVENT("+_mem::operator=", TRACE_TYPE_INFORMATION);
+
+	if(this != &other) {
+		_enabled = other._enabled;
+		_limit = other._limit;
+		_peak = other._peak;
+		_ticks = other._ticks;
+		memcpy(_regions, other._regions, sizeof(size_t) * (MAX_MEM_REGION_TYPE + 1));
+		memcpy(_region_peaks, other._region_peaks, sizeof(size_t) * (MAX_MEM_REGION_TYPE + 1));
+	}
+
+	TRACE_EVENT("-_mem::operator=", TRACE_TYPE_INFORMATION);
+
+	return *this;
+}
+
+void 
+_mem::clear(void)
+{
+	TRACE_EVENT("+_mem::clear", TRACE_TYPE_INFORMATION);
+
+	_peak = 0;
+	_ticks = 0;
+	memset(_regions, 0, sizeof(size_t) * (MAX_MEM_REGION_TYPE + 1));
+	memset(_region_peaks, 0, sizeof(size_t) * (MAX_MEM_REGION_TYPE + 1));
+
+	TRACE_EVENT("-_mem::clear", TRACE_TYPE_INFORMATION);
+}
+
+size_t 
+_mem::get_current(void)
+{
+	size_t type = 0, result = 0;
+
+	for(; type <= MAX_MEM_REGION_TYPE; ++type) {
+		result += _regions[type];
+	}
+
+	return result;
+}
+
+size_t 
+_mem::get_current(
+	size_t type
+	)
+{
+	return (type <= MAX_MEM_REGION_TYPE) ? _regions[type] : 0;
+}
+
+size_t 
+_mem::get_limit(void)
+{
+	return _limit;
+}
+
+size_t 
+_mem::get_peak(void)
+{
+	return _peak;
+}
+
+bool 
+_mem::is_enabled(void)
+{
+	return _enabled;
+}
+
+bool 
+_mem::is_sample_due(void)
+{
+	return !(++_ticks & (MEM_SAMPLE_INTERVAL - 1));
+}
+
+void 
+_mem::set(
+	size_t type,
+	size_t count
+	)
+{
+	size_t current;
+
+	if(type <= MAX_MEM_REGION_TYPE) {
+		_regions[type] = count;
+
+		if(count > _region_peaks[type]) {
+			_region_peaks[type] = count;
+		}
+		current = get_current();
+
+		if(current > _peak) {
+			_peak = current;
+		}
+	}
+}
+
+void 
+_mem::set_enabled(
+	bool enabled
+	)
+{
+	TRACE_EVENT("+_mem::set_enabled", TRACE_TYPE_INFORMATION);
+
+	_enabled = enabled;
+
+	TRACE_EVENT("-_mem::set_enabled", TRACE_TYPE_INFORMATION);
+}
+
+void 
+_mem::set_limit(
+	size_t limit
+	)
+{
+	TRACE_EVENT("+_mem::set_limit", TRACE_TYPE_INFORMATION);
+
+	_limit = limit;
+
+	if(_limit) {
+		_enabled = true;
+	}
+
+	TRACE_EVENT("-_mem::set_limit", TRACE_TYPE_INFORMATION);
+}
+
+void 
+_mem::test_limit(void)
+{
+	size_t current;
+
+	if(_limit) {
+		current = get_current();
+
+		if(current > _limit) {
+			TRACE_EVENT("Memory limit exceeded: " << current << "/" << _limit, TRACE_TYPE_ERROR);
+			THROW_MEM_EXC_W_MESS(current << " bytes (limit " << _limit << " bytes)", MEM_EXC_LIMIT_EXCEEDED);
+		}
+	}
+}
+
+std::string 
+_mem::to_string(void)
+{
+	TRACE_EVENT("+_mem::to_string", TRACE_TYPE_INFORMATION);
+
+	size_t type = 0;
+	std::stringstream ss;
+
+	ss << "Memory (estimated bytes):" << std::endl << std::setw(16) << "current" << std::setw(16) << "peak" << "  region";
+
+	for(; type <= MAX_MEM_REGION_TYPE; ++type) {
+		ss << std::endl << std::setw(16) << _regions[type] << std::setw(16) << _region_peaks[type] 
+			<< "  " << MEM_REGION_STRING(type);
+	}
+	ss << std::endl << std::setw(16) << get_current() << std::setw(16) << _peak << "  total";
+
+	if(_limit) {
+		ss << " (limit " << _limit << ")";
+	}
+
+	TRACE_EVENT("-_mem::to_string", TRACE_TYPE_INFORMATION);
+
+	return ss.str();
+}
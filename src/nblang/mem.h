@@ -0,0 +1,179 @@
+/*
+ * mem.h
+ * Copyright (C) 2013 David Jolly
+ * ----------------------
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef MEM_H_
+#define MEM_H_
+
+#include "mem_type.h"
+
+/*
+ * Memory accounting class
+ * (estimated bytes held by an executor's parsed program, scope tree and
+ * value stack; regions are measured every few evaluated statements, so
+ * the peak may trail a short-lived spike)
+ */
+typedef class _mem {
+
+	public:
+
+		/*
+		 * Memory accounting constructor
+		 */
+		_mem(void);
+
+		/*
+		 * Memory accounting constructor
+		 * @param other memory accounting object reference
+		 */
+		_mem(
+			const _mem &other
+			);
+
+		/*
+		 * Memory accounting destructor
+		 */
+		virtual ~_mem(void);
+
+		/*
+		 * Memory accounting assignment operator
+		 * @param other memory accounting object reference
+		 * @return memory accounting object reference
+		 */
+		_mem &operator=(
+			const _mem &other
+			);
+
+		/*
+		 * Clear all measurements
+		 * (enabled status and limit are kept)
+		 */
+		void clear(void);
+
+		/*
+		 * Retrieve current byte count
+		 * @return current byte count, summed over all regions
+		 */
+		size_t get_current(void);
+
+		/*
+		 * Retrieve current region byte count
+		 * @param type region type
+		 * @return current region byte count
+		 */
+		size_t get_current(
+			size_t type
+			);
+
+		/*
+		 * Retrieve byte limit
+		 * @return byte limit, zero if unlimited
+		 */
+		size_t get_limit(void);
+
+		/*
+		 * Retrieve peak byte count
+		 * @return peak byte count, summed over all regions
+		 */
+		size_t get_peak(void);
+
+		/*
+		 * Retrieve enabled status
+		 * @return true if enabled, false otherwise
+		 */
+		bool is_enabled(void);
+
+		/*
+		 * Advance the statement count, retrieving sample status
+		 * @return true if a sample is due, false otherwise
+		 */
+		bool is_sample_due(void);
+
+		/*
+		 * Set region byte count, updating the peak
+		 * @param type region type
+		 * @param count region byte count
+		 */
+		void set(
+			size_t type,
+			size_t count
+			);
+
+		/*
+		 * Set enabled status
+		 * @param enabled enabled status
+		 */
+		void set_enabled(
+			bool enabled
+			);
+
+		/*
+		 * Set byte limit
+		 * (a non-zero limit also enables accounting)
+		 * @param limit byte limit, zero if unlimited
+		 */
+		void set_limit(
+			size_t limit
+			);
+
+		/*
+		 * Throw if the current byte count exceeds the limit
+		 */
+		void test_limit(void);
+
+		/*
+		 * Retrieve string represenation
+		 * @return string represenation
+		 */
+		std::string to_string(void);
+
+	protected:
+
+		/*
+		 * Memory accounting enabled status
+		 */
+		bool _enabled;
+
+		/*
+		 * Memory byte limit
+		 */
+		size_t _limit;
+
+		/*
+		 * Memory peak byte count
+		 */
+		size_t _peak;
+
+		/*
+		 * Memory region byte counts, indexed by region type
+		 */
+		size_t _regions[MAX_MEM_REGION_TYPE + 1];
+
+		/*
+		 * Memory region peak byte counts, indexed by region type
+		 */
+		size_t _region_peaks[MAX_MEM_REGION_TYPE + 1];
+
+		/*
+		 * Statements evaluated since the last sample
+		 */
+		size_t _ticks;
+
+} mem, *mem_ptr;
+
+#endif
@@ -0,0 +1,88 @@
+/*
+ * mem_type.h
+ * Copyright (C) 2013 David Jolly
+ * ----------------------
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef MEM_TYPE_H_
+#define MEM_TYPE_H_
+
+#include <string>
+
+class _mem;
+typedef _mem mem, *mem_ptr;
+
+/*
+ * Memory exception types
+ */
+enum {
+	MEM_EXC_LIMIT_EXCEEDED = 0,
+};
+
+/*
+ * Memory region types
+ */
+enum {
+	MEM_REGION_PROGRAM = 0,
+	MEM_REGION_SCOPE,
+	MEM_REGION_STACK,
+};
+
+/*
+ * Max memory types
+ */
+#define MAX_MEM_EXC_TYPE MEM_EXC_LIMIT_EXCEEDED
+#define MAX_MEM_REGION_TYPE MEM_REGION_STACK
+
+/*
+ * Memory sample interval, in evaluated statements
+ * (must be a power of two)
+ */
+#define MEM_SAMPLE_INTERVAL 0x40
+
+/*
+ * Memory strings
+ */
+static const std::string MEM_EXC_STR[] = {
+	"Memory limit exceeded",
+};
+
+static const std::string MEM_REGION_STR[] = {
+	"program", "scope", "stack",
+};
+
+/*
+ * Memory string lookup macros
+ */
+#define MEM_EXC_STRING(_T_) (_T_ > MAX_MEM_EXC_TYPE ? "Unknown memory exception type" : MEM_EXC_STR[_T_])
+#define MEM_REGION_STRING(_T_) (_T_ > MAX_MEM_REGION_TYPE ? "unknown" : MEM_REGION_STR[_T_])
+
+/*
+ * Memory exception macros
+ */
+#define THROW_MEM_EXC(_T_) {\
+	std::stringstream ss;\
+	ss << MEM_EXC_STRING(_T_);\
+	throw std::runtime_error(ss.str().c_str());\
+	}
+	
+#define THROW_MEM_EXC_W_MESS(_M_, _T_) {\
+	std::stringstream ss;\
+	ss << MEM_EXC_STRING(_T_) << ": " << _M_;\
+	throw std::runtime_error(ss.str().c_str());\
+	}
+
+#endif
@@ -20,9 +20,9 @@
 #ifndef NODE_H_
 #define NODE_H_
 
+#include <cstring>
 #include <sstream>
 #include <stdexcept>
-#include <vector>
 #include "node_type.h"
 
 /*
@@ -33,6 +33,12 @@ class _node {
 
 	public:
 
+		/*
+		 * Node children iterator types
+		 */
+		typedef _node<T> **child_iterator;
+		typedef _node<T> *const *const_child_iterator;
+
 		/*
 		 * Node constructor
 		 */
@@ -103,6 +109,12 @@ class _node {
 		 */
 		T &get(void);
 
+		/*
+		 * Retrieve node value
+		 * @return constant node value reference
+		 */
+		const T &get(void) const;
+
 		/*
 		 * Retrieve child node at a given index
 		 * @param index child node index
@@ -112,23 +124,44 @@ class _node {
 			size_t index
 			);
 
+		/*
+		 * Retrieve child node at a given index
+		 * @param index child node index
+		 * @return constant child node pointer
+		 */
+		const _node<T> *get_child(
+			size_t index
+			) const;
+
 		/* 
 		 * Retrieve node children begin iterator
 		 * @return node children begin iterator
 		 */
-		typename std::vector<_node<T> *>::iterator get_child_begin(void);
+		child_iterator get_child_begin(void);
+
+		/* 
+		 * Retrieve node children begin iterator
+		 * @return constant node children begin iterator
+		 */
+		const_child_iterator get_child_begin(void) const;
 
 		/* 
 		 * Retrieve child node count
 		 * @return child node count
 		 */
-		size_t get_child_count(void);
+		size_t get_child_count(void) const;
 
 		/* 
 		 * Retrieve node children end iterator
 		 * @return node children end iterator
 		 */
-		typename std::vector<_node<T> *>::iterator get_child_end(void);
+		child_iterator get_child_end(void);
+
+		/* 
+		 * Retrieve node children end iterator
+		 * @return constant node children end iterator
+		 */
+		const_child_iterator get_child_end(void) const;
 
 		/* 
 		 * Retrieve parent node
@@ -136,17 +169,23 @@ class _node {
 		 */
 		_node<T> *get_parent(void);
 
+		/* 
+		 * Retrieve parent node
+		 * @return constant parent node pointer
+		 */
+		const _node<T> *get_parent(void) const;
+
 		/*
 		 * Retrieve parent node status
 		 * @return true if has parent, false otherwise
 		 */
-		bool has_parent(void);
+		bool has_parent(void) const;
 
 		/*
 		 * Retrieve children node status
 		 * @return true if has children, false otherwise
 		 */
-		bool has_children(void);
+		bool has_children(void) const;
 
 		/*
 		 * Insert child into node at a given index
@@ -158,6 +197,18 @@ class _node {
 			size_t index
 			);
 
+		/*
+		 * Insert children into node at a given index
+		 * @param children child node pointer array
+		 * @param count child node count
+		 * @param index child index
+		 */
+		void insert_children(
+			_node<T> *const *children,
+			size_t count,
+			size_t index
+			);
+
 		/*
 		 * Remove child from node at a given index
 		 * @param index child index
@@ -204,9 +255,23 @@ class _node {
 	protected:
 
 		/*
-		 * Node children
+		 * Node children storage (inline until the node outgrows
+		 * NODE_INLINE_CHILD_COUNT children, then a heap array)
+		 */
+		union {
+			_node<T> *inline_children[NODE_INLINE_CHILD_COUNT];
+			_node<T> **heap_children;
+		} _child_store;
+
+		/*
+		 * Node children capacity
 		 */
-		std::vector<_node<T> *> _children;
+		unsigned int _child_capacity;
+
+		/*
+		 * Node children count
+		 */
+		unsigned int _child_count;
 
 		/*
 		 * Node parent
@@ -218,10 +283,45 @@ class _node {
 		 */
 		T _value;
 
+		/*
+		 * Retrieve node children storage
+		 * @return node children array
+		 */
+		_node<T> **_child_data(void);
+
+		/*
+		 * Retrieve node children storage
+		 * @return constant node children array
+		 */
+		_node<T> *const *_child_data(void) const;
+
+		/*
+		 * Copy children pointers from another node
+		 * @param other node object reference
+		 */
+		void _copy_children(
+			const _node<T> &other
+			);
+
+		/*
+		 * Release heap children storage, returning to inline storage
+		 */
+		void _release_children(void);
+
+		/*
+		 * Grow children storage to hold at least a given number of children
+		 * @param capacity minimum children capacity
+		 */
+		void _reserve_children(
+			size_t capacity
+			);
+
 };
 
 template <class T> 
-_node<T>::_node(void)
+_node<T>::_node(void) :
+	_child_capacity(NODE_INLINE_CHILD_COUNT),
+	_child_count(0)
 {
 	clear();
 };
@@ -229,7 +329,9 @@ _node<T>::_node(void)
 template <class T> 
 _node<T>::_node(
 	const T &value
-	)
+	) :
+		_child_capacity(NODE_INLINE_CHILD_COUNT),
+		_child_count(0)
 {
 	clear(value);
 }
@@ -238,17 +340,18 @@ template <class T>
 _node<T>::_node(
 	const _node<T> &other
 	) :
-		_children(other._children),
+		_child_capacity(NODE_INLINE_CHILD_COUNT),
+		_child_count(0),
 		_parent(other._parent),
 		_value(other._value)
 {
-	return;
+	_copy_children(other);
 };
 
 template <class T> 
 _node<T>::~_node(void)
 {
-	return;
+	_release_children();
 };
 
 template <class T> _node<T> &
@@ -257,7 +360,7 @@ _node<T>::operator=(
 	)
 {
 	if(this != &other) {
-		_children = other._children;
+		_copy_children(other);
 		_parent = other._parent;
 		_value = other._value;
 	}
@@ -265,6 +368,66 @@ _node<T>::operator=(
 	return *this;
 }
 
+template <class T> _node<T> **
+_node<T>::_child_data(void)
+{
+	return (_child_capacity > NODE_INLINE_CHILD_COUNT) ? _child_store.heap_children : _child_store.inline_children;
+}
+
+template <class T> _node<T> *const *
+_node<T>::_child_data(void) const
+{
+	return (_child_capacity > NODE_INLINE_CHILD_COUNT) ? _child_store.heap_children : _child_store.inline_children;
+}
+
+template <class T> void 
+_node<T>::_copy_children(
+	const _node<T> &other
+	)
+{
+	_child_count = 0;
+	_reserve_children(other._child_count);
+	std::memcpy(_child_data(), other._child_data(), other._child_count * sizeof(_node<T> *));
+	_child_count = other._child_count;
+}
+
+template <class T> void 
+_node<T>::_release_children(void)
+{
+	if(_child_capacity > NODE_INLINE_CHILD_COUNT) {
+		delete [] _child_store.heap_children;
+		_child_capacity = NODE_INLINE_CHILD_COUNT;
+	}
+	_child_count = 0;
+}
+
+template <class T> void 
+_node<T>::_reserve_children(
+	size_t capacity
+	)
+{
+	_node<T> **children = NULL;
+
+	if(capacity > _child_capacity) {
+
+		if(capacity < (_child_capacity * 2)) {
+			capacity = _child_capacity * 2;
+		}
+		children = new _node<T> *[capacity];
+
+		if(!children) {
+			THROW_NODE_EXC(NODE_EXC_OUT_OF_MEMORY);
+		}
+		std::memcpy(children, _child_data(), _child_count * sizeof(_node<T> *));
+
+		if(_child_capacity > NODE_INLINE_CHILD_COUNT) {
+			delete [] _child_store.heap_children;
+		}
+		_child_store.heap_children = children;
+		_child_capacity = (unsigned int) capacity;
+	}
+}
+
 template <class T> void 
 _node<T>::add_child_back(
 	_node<T> *child
@@ -284,7 +447,7 @@ _node<T>::add_child_front(
 template <class T> void 
 _node<T>::clear(void)
 {
-	_children.clear();
+	_release_children();
 	_parent = NULL;
 	_value.clear();
 };
@@ -294,7 +457,7 @@ _node<T>::clear(
 	const T &value
 	)
 {
-	_children.clear();
+	_release_children();
 	_parent = NULL;
 	_value = value;
 }
@@ -305,34 +468,64 @@ _node<T>::get(void)
 	return _value;
 };
 
+template <class T> const T &
+_node<T>::get(void) const
+{
+	return _value;
+};
+
 template <class T> _node<T> *
 _node<T>::get_child(
 	size_t index
 	)
 {
-	if(index >= _children.size()) {
+	if(index >= _child_count) {
+		THROW_NODE_EXC_W_MESS(index, NODE_EXC_INVALID_CHILD_NODE_INDEX);
+	}
+
+	return _child_data()[index];
+};
+
+template <class T> const _node<T> *
+_node<T>::get_child(
+	size_t index
+	) const
+{
+	if(index >= _child_count) {
 		THROW_NODE_EXC_W_MESS(index, NODE_EXC_INVALID_CHILD_NODE_INDEX);
 	}
 
-	return _children.at(index);
+	return _child_data()[index];
 };
 
-template <class T> typename std::vector<_node<T> *>::iterator 
+template <class T> typename _node<T>::child_iterator 
 _node<T>::get_child_begin(void)
 {
-	return _children.begin();
+	return _child_data();
+}
+
+template <class T> typename _node<T>::const_child_iterator 
+_node<T>::get_child_begin(void) const
+{
+	return _child_data();
 }
 
 template <class T> size_t 
-_node<T>::get_child_count(void)
+_node<T>::get_child_count(void) const
 {
-	return _children.size();
+	return _child_count;
 };
 
-template <class T> typename std::vector<_node<T> *>::iterator 
+template <class T> typename _node<T>::child_iterator 
 _node<T>::get_child_end(void)
 {
-	return _children.end();
+	return _child_data() + _child_count;
+}
+
+template <class T> typename _node<T>::const_child_iterator 
+_node<T>::get_child_end(void) const
+{
+	return _child_data() + _child_count;
 }
 
 template <class T> _node<T> *
@@ -345,16 +538,26 @@ _node<T>::get_parent(void)
 	return _parent;
 };
 
+template <class T> const _node<T> *
+_node<T>::get_parent(void) const
+{
+	if(!_parent) {
+		THROW_NODE_EXC(NODE_EXC_INVALID_PARENT_NODE);
+	}
+
+	return _parent;
+};
+
 template <class T> bool 
-_node<T>::has_parent(void)
+_node<T>::has_parent(void) const
 {
 	return _parent != NULL;
 };
 
 template <class T> bool 
-_node<T>::has_children(void)
+_node<T>::has_children(void) const
 {
-	return !_children.empty();
+	return _child_count > 0;
 };
 
 template <class T> void 
@@ -363,15 +566,47 @@ _node<T>::insert_child(
 	size_t index
 	)
 {
-	if(index < _children.size()) {
-		_children.insert(_children.begin() + index, child);
-		_children.at(index)->set_parent(this);
-	} else if(index == _children.size()) {
-		_children.push_back(child);
-		_children.back()->set_parent(this);
-	} else {
+	_node<T> **data = NULL;
+
+	if(index > _child_count) {
 		THROW_NODE_EXC_W_MESS(index, NODE_EXC_INVALID_CHILD_NODE_INDEX);
 	}
+	_reserve_children(_child_count + 1);
+	data = _child_data();
+
+	if(index < _child_count) {
+		std::memmove(data + index + 1, data + index, (_child_count - index) * sizeof(_node<T> *));
+	}
+	data[index] = child;
+	++_child_count;
+	child->set_parent(this);
+};
+
+template <class T> void 
+_node<T>::insert_children(
+	_node<T> *const *children,
+	size_t count,
+	size_t index
+	)
+{
+	size_t i = 0;
+	_node<T> **data = NULL;
+
+	if(index > _child_count) {
+		THROW_NODE_EXC_W_MESS(index, NODE_EXC_INVALID_CHILD_NODE_INDEX);
+	}
+	_reserve_children(_child_count + count);
+	data = _child_data();
+
+	if(index < _child_count) {
+		std::memmove(data + index + count, data + index, (_child_count - index) * sizeof(_node<T> *));
+	}
+	std::memcpy(data + index, children, count * sizeof(_node<T> *));
+	_child_count += (unsigned int) count;
+
+	for(; i < count; ++i) {
+		children[i]->set_parent(this);
+	}
 };
 
 template <class T> _node<T> *
@@ -379,13 +614,17 @@ _node<T>::remove_child(
 	size_t index
 	)
 {
-	_node<T> *old_child = NULL;
+	_node<T> *old_child = NULL, **data = _child_data();
 
-	if(index >= _children.size()) {
+	if(index >= _child_count) {
 		THROW_NODE_EXC_W_MESS(index, NODE_EXC_INVALID_CHILD_NODE_INDEX);
 	}
-	old_child = _children.at(index);
-	_children.erase(_children.begin() + index);
+	old_child = data[index];
+	--_child_count;
+
+	if(index < _child_count) {
+		std::memmove(data + index, data + index + 1, (_child_count - index) * sizeof(_node<T> *));
+	}
 
 	return old_child;
 };
@@ -393,7 +632,7 @@ _node<T>::remove_child(
 template <class T> void 
 _node<T>::remove_children(void)
 {
-	_children.clear();
+	_release_children();
 };
 
 template <class T> _node<T> *
@@ -402,13 +641,13 @@ _node<T>::set_child(
 	size_t index
 	)
 {
-	_node<T> *old_child = NULL;
+	_node<T> *old_child = NULL, **data = _child_data();
 
-	if(index >= _children.size()) {
+	if(index >= _child_count) {
 		THROW_NODE_EXC_W_MESS(index, NODE_EXC_INVALID_CHILD_NODE_INDEX);
 	}
-	old_child = _children.at(index);
-	_children.at(index) = child;
+	old_child = data[index];
+	data[index] = child;
 
 	return old_child;
 };
@@ -441,7 +680,7 @@ _node<T>::to_string(
 		}
 
 		if(has_children()) {
-			ss << " (" << _children.size() << ")";
+			ss << " (" << _child_count << ")";
 		} else {
 			ss << " (LEAF)";
 		}		
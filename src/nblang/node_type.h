@@ -28,12 +28,18 @@
 enum {
 	NODE_EXC_INVALID_CHILD_NODE_INDEX = 0,
 	NODE_EXC_INVALID_PARENT_NODE,
+	NODE_EXC_OUT_OF_MEMORY,
 };
 
 /*
  * Max node types
  */
-#define MAX_NODE_EXC_TYPE NODE_EXC_INVALID_PARENT_NODE
+#define MAX_NODE_EXC_TYPE NODE_EXC_OUT_OF_MEMORY
+
+/*
+ * Node inline child count (children beyond this count spill to the heap)
+ */
+#define NODE_INLINE_CHILD_COUNT 2
 
 /*
  * Node strings
@@ -41,6 +47,7 @@ enum {
 static const std::string NODE_EXC_STR[] = {
 	"Attempting to transition to invalid child node index",
 	"Attempting to transition to invalid parent node",
+	"Failed to allocate node children",
 };
 
 /*
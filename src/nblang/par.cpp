@@ -19,11 +19,13 @@
 
 #include <sstream>
 #include <stdexcept>
+#include "hpf.h"
 #include "par.h"
 
 //#define PARSER_TRACING
 #ifndef PARSER_TRACING
-#define TRACE_EVENT(_M_, _T_)
+#define TRACE_SUBSYSTEM TRC_SUBSYSTEM_PARSER
+#include "trace.h"
 #else
 #define TRACE_HEADER "parser"
 #include "trace.h"
@@ -147,6 +149,8 @@ _par::enumerate(void)
 {
 	TRACE_EVENT("+_par::enumerate", TRACE_TYPE_INFORMATION);
 
+	HPF_OWNER(HPF_OWNER_PARSER);
+
 	clear();
 	lex::move_next();
 
@@ -238,13 +242,10 @@ _par::import_statements(
 {
 	TRACE_EVENT("+_par::import_statements", TRACE_TYPE_INFORMATION);
 
-	size_t i = 1;
-
 	if(statements.get_link_count() >= MIN_IMPORT_STATEMENT_COUNT) {
-
-		for(; i < statements.get_link_count() - 1; ++i) {
-			_statements.insert(statements.get(i), _position + i + (_statements.get_link_count() >= MIN_IMPORT_STATEMENT_COUNT ? (-1) : 0));
-		}
+		statements.remove_front();
+		statements.remove_back();
+		_statements.splice(statements, _statements.has_links() ? (_position + 1) : 0);
 	}
 
 	TRACE_EVENT("-_par::import_statements", TRACE_TYPE_INFORMATION);
@@ -258,6 +259,8 @@ _par::initialize(
 {
 	TRACE_EVENT("+_par::initialize", TRACE_TYPE_INFORMATION);
 
+	HPF_OWNER(HPF_OWNER_PARSER);
+
 	lex::initialize(input, is_file);
 	reset();
 	lex::enumerate();
@@ -270,12 +273,25 @@ _par::move_next(void)
 {
 	TRACE_EVENT("+_par::move_next", TRACE_TYPE_INFORMATION);
 
-	tok_stmt stmt;
+	HPF_OWNER(HPF_OWNER_PARSER);
+	tok_stmt_ptr stmt = NULL;
 
 	if(lex::has_next()
-			&& _position == (_statements.get_link_count() - 2)) {\
-		_invoke_enumeration_action(stmt, PAR_ENUM_ACTION_STATEMENT);
-		_statements.insert(stmt, ++_position);
+			&& _position == (_statements.get_link_count() - 2)) {
+		stmt = new tok_stmt;
+
+		if(!stmt) {
+			THROW_PAR_EXC(PAR_EXC_OUT_OF_MEMORY);
+		}
+
+		try {
+			_invoke_enumeration_action(*stmt, PAR_ENUM_ACTION_STATEMENT);
+			_statements.insert(stmt, _position + 1);
+		} catch(...) {
+			delete stmt;
+			throw;
+		}
+		++_position;
 	} else if(_position < (_statements.get_link_count() - 1)) {
 		++_position;
 	} else {
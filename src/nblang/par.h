@@ -119,7 +119,8 @@ typedef class _par :
 		bool has_statements(void);
 
 		/*
-		 * Import statements
+		 * Import statements after the current statement
+		 * (statements are moved out of the statement list, not copied)
 		 * @param statements statement list object reference
 		 */
 		void import_statements(
@@ -28,7 +28,8 @@
 
 //#define PARSER_EXT_TRACING
 #ifndef PARSER_EXT_TRACING
-#define TRACE_EVENT(_M_, _T_)
+#define TRACE_SUBSYSTEM TRC_SUBSYSTEM_PARSER
+#include "trace.h"
 #else
 #define TRACE_HEADER "parser_ext"
 #include "trace.h"
@@ -1319,7 +1320,7 @@ par_enum_io(
 		}
 
 		if(!direction_both
-				&& !IS_SUBTYPE_L(lexer, IO_OPERATOR_TYPE_IN)) {
+				&& IS_SUBTYPE_L(lexer, IO_OPERATOR_TYPE_OUT)) {
 			TRACE_EVENT("Invalid input io operator token: " << lexer->to_string(true), TRACE_TYPE_ERROR);
 			THROW_PAR_EXT_EXC_W_MESS(lexer->to_string(true), PAR_EXT_EXC_EXPECT_INPUT_IO_OPERATOR);			
 		}
@@ -1348,6 +1349,17 @@ par_enum_io(
 				par_enum_expression_root(lexer, statement);
 				break;
 			case IO_OPERATOR_TYPE_EXECUTE:
+
+				while(IS_TYPE_L(lexer, TOKEN_TYPE_EXEC_OPERATOR)) {
+					par_add_token_back(lexer, statement);
+					par_advance_lexer(lexer);
+
+					if(!IS_TOKEN_SYMBOL_TYPE_L(lexer, SYMBOL_TYPE_LIST_SEPERATOR)) {
+						TRACE_EVENT("Invalid list seperator token: " << lexer->to_string(true), TRACE_TYPE_ERROR);
+						THROW_PAR_EXT_EXC_W_MESS(lexer->to_string(true), PAR_EXT_EXC_EXPECT_LIST_SEPERATOR);
+					}
+					par_advance_lexer(lexer);
+				}
 				par_enum_expression_root(lexer, statement);
 				break;
 			default:
@@ -1696,6 +1708,17 @@ par_enum_stream_statement(
 				}
 				break;
 			case STREAM_TYPE_STDIN:
+
+				if(IS_TOKEN_SYMBOL_TYPE_L(lexer, SYMBOL_TYPE_STATEMENT_SEPERATOR)) {
+					par_advance_lexer(lexer);
+					par_enum_file_stream_list(lexer, statement);
+
+					if(IS_TOKEN_SYMBOL_TYPE_L(lexer, SYMBOL_TYPE_LIST_SEPERATOR)) {
+						par_advance_lexer(lexer);
+						par_enum_expression_root(lexer, statement);
+					}
+				}
+				break;
 			case STREAM_TYPE_STDOUT:
 				break;
 			default:
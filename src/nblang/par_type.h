@@ -39,6 +39,7 @@ enum {
 	PAR_EXC_NO_NEXT_TOKEN,
 	PAR_EXC_NO_PREV_TOKEN,
 	PAR_EXC_OUT_OF_BOUNDS,
+	PAR_EXC_OUT_OF_MEMORY,
 	PAR_EXC_UNALLOC_ACTION,
 	PAR_EXC_UNALLOC_ENUM_ACTION,
 };
@@ -68,6 +69,7 @@ static const std::string PAR_EXC_STR[] = {
 	"No next statement found",
 	"No previous statement found",
 	"Attempting to transition to non-existant statement",
+	"Failed to allocate statement",
 	"Attempting call to unallocated parser action",
 	"Attempting call to unallocated parser enumeration action",
 };
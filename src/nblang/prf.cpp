@@ -0,0 +1,431 @@
+/*
+ * prf.cpp
+ * Copyright (C) 2013 David Jolly
+ * ----------------------
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <algorithm>
+#include <iomanip>
+#include <sstream>
+#include <stdexcept>
+#include "clk.h"
+#include "lang.h"
+#include "prf.h"
+
+//#define PRF_TRACING
+#ifndef PRF_TRACING
+#define TRACE_SUBSYSTEM TRC_SUBSYSTEM_EXECUTOR
+#include "trace.h"
+#else
+#define TRACE_HEADER "prf"
+#include "trace.h"
+#endif
+
+/*
+ * Compare profiler line samples by self time
+ * @param left left line sample reference
+ * @param right right line sample reference
+ * @return true if left has more self time than right, false otherwise
+ */
+static bool 
+prf_compare_exclusive(
+	const std::pair<size_t, prf_entry> &left,
+	const std::pair<size_t, prf_entry> &right
+	)
+{
+	return (left.second.exclusive == right.second.exclusive) ? (left.first < right.first) 
+		: (left.second.exclusive > right.second.exclusive);
+}
+
+/*
+ * Compare profiler function call samples by self time
+ * @param left left call sample reference
+ * @param right right call sample reference
+ * @return true if left has more self time than right, false otherwise
+ */
+static bool 
+prf_compare_call_exclusive(
+	const std::pair<size_t, prf_call> &left,
+	const std::pair<size_t, prf_call> &right
+	)
+{
+	return (left.second.exclusive == right.second.exclusive) ? (left.first < right.first) 
+		: (left.second.exclusive > right.second.exclusive);
+}
+
+/*
+ * Format a profiler sample row
+ * @param stream output stream reference
+ * @param entry profiler sample reference
+ * @param total total profiled time
+ */
+static void 
+prf_format_entry(
+	std::stringstream &stream,
+	const prf_entry &entry,
+	unsigned long long total
+	)
+{
+	stream << std::setw(12) << entry.count 
+		<< std::setw(14) << (entry.inclusive / 1000000.0) 
+		<< std::setw(14) << (entry.exclusive / 1000000.0)
+		<< std::setw(8) << (total ? ((entry.exclusive * 100.0) / total) : 0.0) << "%"
+		<< "  " << TOKEN_TYPE_STRING(entry.type);
+}
+
+_prf::_prf(void) :
+	_enabled(false),
+	_total(0)
+{
+	TRACE_EVENT("+_prf::_prf", TRACE_TYPE_INFORMATION);
+
+	clear();
+
+	TRACE_EVENT("-_prf::_prf", TRACE_TYPE_INFORMATION);
+}
+
+_prf::_prf(
+	const _prf &other
+	) :
+		_enabled(other._enabled),
+		_calls(other._calls),
+		_call_tree(other._call_tree),
+		_lines(other._lines),
+		_statements(other._statements),
+		_total(other._total)
+{
+	TRACE_EVENT("+_prf::_prf", TRACE_TYPE_INFORMATION);
+	TRACE_EVENT("-_prf::_prf", TRACE_TYPE_INFORMATION);
+}
+
+_prf::~_prf(void)
+{
+	TRACE_EVENT("+_prf::~_prf", TRACE_TYPE_INFORMATION);
+	TRACE_EVENT("-_prf::~_prf", TRACE_TYPE_INFORMATION);
+}
+
+_prf &
+_prf::operator=(
+	const _prf &other
+	)
+{
+	TRACE_EVENT("+_prf::operator=", TRACE_TYPE_INFORMATION);
+
+	if(this != &other) {
+		_enabled = other._enabled;
+		_call_frames.clear();
+		_calls = other._calls;
+		_call_tree = other._call_tree;
+		_frames.clear();
+		_lines = other._lines;
+		_statements = other._statements;
+		_total = other._total;
+	}
+
+	TRACE_EVENT("-_prf::operator=", TRACE_TYPE_INFORMATION);
+
+	return *this;
+}
+
+void 
+_prf::_fold_call_node(
+	std::stringstream &stream,
+	size_t node,
+	const std::string &prefix
+	)
+{
+	std::string path;
+	std::map<size_t, size_t>::iterator child = _call_tree.at(node).children.begin();
+
+	for(; child != _call_tree.at(node).children.end(); ++child) {
+		path = prefix + (prefix.empty() ? "" : ";") + atm::get_text(_call_tree.at(child->second).id);
+
+		stream << path << " " << ((_call_tree.at(child->second).exclusive + PRF_FOLD_UNIT - 1) / PRF_FOLD_UNIT) << std::endl;
+		_fold_call_node(stream, child->second, path);
+	}
+}
+
+void 
+_prf::clear(void)
+{
+	TRACE_EVENT("+_prf::clear", TRACE_TYPE_INFORMATION);
+
+	prf_call_node root;
+
+	root.exclusive = 0;
+	root.id = ATM_INVALID_ID;
+	root.parent = PRF_CALL_ROOT;
+	_call_frames.clear();
+	_calls.clear();
+	_call_tree.clear();
+	_call_tree.push_back(root);
+	_frames.clear();
+	_lines.clear();
+	_statements.clear();
+	_total = 0;
+
+	TRACE_EVENT("-_prf::clear", TRACE_TYPE_INFORMATION);
+}
+
+void 
+_prf::enter_call(
+	size_t id
+	)
+{
+	TRACE_EVENT("+_prf::enter_call", TRACE_TYPE_VERBOSE);
+
+	prf_call_node node;
+	prf_call_frame frame;
+	std::map<size_t, size_t>::iterator child;
+	size_t parent = _call_frames.empty() ? PRF_CALL_ROOT : _call_frames.back().node;
+
+	child = _call_tree.at(parent).children.find(id);
+
+	if(child == _call_tree.at(parent).children.end()) {
+		node.exclusive = 0;
+		node.id = id;
+		node.parent = parent;
+		frame.node = _call_tree.size();
+		_call_tree.push_back(node);
+		_call_tree.at(parent).children.insert(std::pair<size_t, size_t>(id, frame.node));
+	} else {
+		frame.node = child->second;
+	}
+	frame.call = &_calls[id];
+	frame.child = 0;
+	++frame.call->count;
+
+	if(++frame.call->active > frame.call->depth) {
+		frame.call->depth = frame.call->active;
+	}
+	frame.start = clk::now();
+	_call_frames.push_back(frame);
+
+	TRACE_EVENT("-_prf::enter_call", TRACE_TYPE_VERBOSE);
+}
+
+void 
+_prf::enter(
+	const tok &token
+	)
+{
+	TRACE_EVENT("+_prf::enter", TRACE_TYPE_VERBOSE);
+
+	prf_frame frame;
+
+	frame.child = 0;
+	frame.line = &_lines[token.get_line()];
+	frame.statement = &_statements[std::pair<size_t, size_t>(token.get_line(), token.get_position())];
+
+	if(!frame.line->count) {
+		frame.line->type = token.get_type();
+	}
+
+	if(!frame.statement->count) {
+		frame.statement->type = token.get_type();
+	}
+	++frame.line->active;
+	++frame.line->count;
+	++frame.statement->active;
+	++frame.statement->count;
+	frame.start = clk::now();
+	_frames.push_back(frame);
+
+	TRACE_EVENT("-_prf::enter", TRACE_TYPE_VERBOSE);
+}
+
+void 
+_prf::exit(void)
+{
+	TRACE_EVENT("+_prf::exit", TRACE_TYPE_VERBOSE);
+
+	prf_frame frame;
+	unsigned long long elapsed, exclusive;
+
+	if(_frames.empty()) {
+		TRACE_EVENT("No active statement to exit", TRACE_TYPE_ERROR);
+		THROW_PRF_EXC(PRF_EXC_NO_ACTIVE_STATEMENT);
+	}
+	elapsed = clk::now();
+	frame = _frames.back();
+	_frames.pop_back();
+	elapsed -= frame.start;
+	exclusive = (elapsed > frame.child) ? (elapsed - frame.child) : 0;
+	frame.line->exclusive += exclusive;
+	frame.statement->exclusive += exclusive;
+
+	if(!--frame.line->active) {
+		frame.line->inclusive += elapsed;
+	}
+
+	if(!--frame.statement->active) {
+		frame.statement->inclusive += elapsed;
+	}
+
+	if(!_frames.empty()) {
+		_frames.back().child += elapsed;
+	} else {
+		_total += elapsed;
+	}
+
+	TRACE_EVENT("-_prf::exit", TRACE_TYPE_VERBOSE);
+}
+
+void 
+_prf::exit_call(void)
+{
+	TRACE_EVENT("+_prf::exit_call", TRACE_TYPE_VERBOSE);
+
+	prf_call_frame frame;
+	unsigned long long elapsed, exclusive;
+
+	if(_call_frames.empty()) {
+		TRACE_EVENT("No active call to exit", TRACE_TYPE_ERROR);
+		THROW_PRF_EXC(PRF_EXC_NO_ACTIVE_CALL);
+	}
+	elapsed = clk::now();
+	frame = _call_frames.back();
+	_call_frames.pop_back();
+	elapsed -= frame.start;
+	exclusive = (elapsed > frame.child) ? (elapsed - frame.child) : 0;
+	frame.call->exclusive += exclusive;
+	_call_tree.at(frame.node).exclusive += exclusive;
+
+	if(!--frame.call->active) {
+		frame.call->inclusive += elapsed;
+	}
+
+	if(!_call_frames.empty()) {
+		_call_frames.back().child += elapsed;
+	}
+
+	TRACE_EVENT("-_prf::exit_call", TRACE_TYPE_VERBOSE);
+}
+
+bool 
+_prf::is_enabled(void)
+{
+	return _enabled;
+}
+
+void 
+_prf::set_enabled(
+	bool enabled
+	)
+{
+	TRACE_EVENT("+_prf::set_enabled", TRACE_TYPE_INFORMATION);
+
+	_enabled = enabled;
+
+	TRACE_EVENT("-_prf::set_enabled", TRACE_TYPE_INFORMATION);
+}
+
+std::string 
+_prf::to_string(
+	bool verbose
+	)
+{
+	TRACE_EVENT("+_prf::to_string", TRACE_TYPE_INFORMATION);
+
+	size_t i = 0, count = 0;
+	std::stringstream ss;
+	std::vector<std::pair<size_t, prf_call>> calls(_calls.begin(), _calls.end());
+	std::vector<std::pair<size_t, prf_entry>> lines(_lines.begin(), _lines.end());
+	std::map<std::pair<size_t, size_t>, prf_entry>::iterator statement = _statements.begin();
+
+	std::sort(lines.begin(), lines.end(), prf_compare_exclusive);
+
+	for(; i < lines.size(); ++i) {
+		count += lines.at(i).second.count;
+	}
+	ss << std::fixed << std::setprecision(3) << "Profile: " << count << " statements, " 
+		<< (_total / 1000000.0) << " ms" << std::endl << std::setw(8) << "line" << std::setw(12) << "count" 
+		<< std::setw(14) << "total ms" << std::setw(14) << "self ms" << std::setw(9) << "self" << "  statement";
+
+	for(i = 0; i < lines.size(); ++i) {
+
+		if(!verbose
+				&& (i == PRF_REPORT_LINE_COUNT)) {
+			ss << std::endl << "(" << (lines.size() - i) << " more lines)";
+			break;
+		}
+		ss << std::endl << std::setw(8) << lines.at(i).first;
+		prf_format_entry(ss, lines.at(i).second, _total);
+	}
+
+	if(!calls.empty()) {
+		std::sort(calls.begin(), calls.end(), prf_compare_call_exclusive);
+		ss << std::endl << std::endl << std::setw(12) << "calls" << std::setw(14) << "total ms" << std::setw(14) << "self ms" 
+			<< std::setw(9) << "self" << std::setw(8) << "depth" << "  function";
+
+		for(i = 0; i < calls.size(); ++i) {
+
+			if(!verbose
+					&& (i == PRF_REPORT_CALL_COUNT)) {
+				ss << std::endl << "(" << (calls.size() - i) << " more functions)";
+				break;
+			}
+			ss << std::endl << std::setw(12) << calls.at(i).second.count << std::setw(14) << (calls.at(i).second.inclusive / 1000000.0) 
+				<< std::setw(14) << (calls.at(i).second.exclusive / 1000000.0) 
+				<< std::setw(8) << (_total ? ((calls.at(i).second.exclusive * 100.0) / _total) : 0.0) << "%"
+				<< std::setw(8) << calls.at(i).second.depth << "  " << atm::get_text(calls.at(i).first);
+		}
+	}
+
+	if(verbose) {
+		ss << std::endl << std::endl << std::setw(8) << "line" << std::setw(6) << "pos" << std::setw(12) << "count" 
+			<< std::setw(14) << "total ms" << std::setw(14) << "self ms" << std::setw(9) << "self" << "  statement";
+
+		for(; statement != _statements.end(); ++statement) {
+			ss << std::endl << std::setw(8) << statement->first.first << std::setw(6) << statement->first.second;
+			prf_format_entry(ss, statement->second, _total);
+		}
+	}
+
+	TRACE_EVENT("-_prf::to_string", TRACE_TYPE_INFORMATION);
+
+	return ss.str();
+}
+
+std::string 
+_prf::to_folded_string(void)
+{
+	TRACE_EVENT("+_prf::to_folded_string", TRACE_TYPE_INFORMATION);
+
+	std::stringstream ss;
+
+	_fold_call_node(ss, PRF_CALL_ROOT, std::string());
+
+	TRACE_EVENT("-_prf::to_folded_string", TRACE_TYPE_INFORMATION);
+
+	return ss.str();
+}
+
+void 
+_prf::unwind(void)
+{
+	TRACE_EVENT("+_prf::unwind", TRACE_TYPE_INFORMATION);
+
+	while(!_call_frames.empty()) {
+		exit_call();
+	}
+
+	while(!_frames.empty()) {
+		exit();
+	}
+
+	TRACE_EVENT("-_prf::unwind", TRACE_TYPE_INFORMATION);
+}
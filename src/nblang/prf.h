@@ -0,0 +1,235 @@
+/*
+ * prf.h
+ * Copyright (C) 2013 David Jolly
+ * ----------------------
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef PRF_H_
+#define PRF_H_
+
+#include <map>
+#include <sstream>
+#include <vector>
+#include "prf_type.h"
+#include "tok.h"
+
+/*
+ * Profiler entry
+ * (times are in nanoseconds; inclusive time is only counted once while
+ * an entry is active, so recursion does not inflate it)
+ */
+typedef struct _prf_entry {
+	size_t active;
+	size_t count;
+	unsigned long long exclusive;
+	unsigned long long inclusive;
+	size_t type;
+} prf_entry, *prf_entry_ptr;
+
+/*
+ * Profiler call entry
+ * (times are in nanoseconds; depth is the deepest recursion seen)
+ */
+typedef struct _prf_call {
+	size_t active;
+	size_t count;
+	size_t depth;
+	unsigned long long exclusive;
+	unsigned long long inclusive;
+} prf_call, *prf_call_ptr;
+
+/*
+ * Profiler call frame
+ */
+typedef struct _prf_call_frame {
+	prf_call_ptr call;
+	unsigned long long child;
+	size_t node;
+	unsigned long long start;
+} prf_call_frame, *prf_call_frame_ptr;
+
+/*
+ * Profiler call tree node
+ * (one node per distinct call stack, used for folded-stack export)
+ */
+typedef struct _prf_call_node {
+	std::map<size_t, size_t> children;
+	unsigned long long exclusive;
+	size_t id;
+	size_t parent;
+} prf_call_node, *prf_call_node_ptr;
+
+/*
+ * Profiler frame
+ */
+typedef struct _prf_frame {
+	unsigned long long child;
+	prf_entry_ptr line;
+	unsigned long long start;
+	prf_entry_ptr statement;
+} prf_frame, *prf_frame_ptr;
+
+/*
+ * Profiler class
+ * (attributes wall time and execution counts to statements and source lines)
+ */
+typedef class _prf {
+
+	public:
+
+		/*
+		 * Profiler constructor
+		 */
+		_prf(void);
+
+		/*
+		 * Profiler constructor
+		 * @param other profiler object reference
+		 */
+		_prf(
+			const _prf &other
+			);
+
+		/*
+		 * Profiler destructor
+		 */
+		virtual ~_prf(void);
+
+		/*
+		 * Profiler assignment operator
+		 * @param other profiler object reference
+		 * @return profiler object reference
+		 */
+		_prf &operator=(
+			const _prf &other
+			);
+
+		/*
+		 * Clear profiler samples
+		 */
+		void clear(void);
+
+		/*
+		 * Enter a function call
+		 * @param id function name atom id
+		 */
+		void enter_call(
+			size_t id
+			);
+
+		/*
+		 * Enter a statement
+		 * @param token statement token reference
+		 */
+		void enter(
+			const tok &token
+			);
+
+		/*
+		 * Exit the most recently entered statement
+		 */
+		void exit(void);
+
+		/*
+		 * Exit the most recently entered function call
+		 */
+		void exit_call(void);
+
+		/*
+		 * Retrieve profiler status
+		 * @return true if enabled, false otherwise
+		 */
+		bool is_enabled(void);
+
+		/*
+		 * Set profiler status
+		 * @param enabled true to enable, false otherwise
+		 */
+		void set_enabled(
+			bool enabled
+			);
+
+		/*
+		 * Retrieve string represenation (hotspot report, sorted by self time)
+		 * @param verbose verbose string status
+		 * @return string represenation
+		 */
+		std::string to_string(
+			bool verbose
+			);
+
+		/*
+		 * Retrieve folded-stack represenation of function calls
+		 * (one "outer;inner self-time" line per call stack, in microseconds rounded up)
+		 * @return folded-stack string represenation
+		 */
+		std::string to_folded_string(void);
+
+		/*
+		 * Exit all active statements and function calls
+		 * (called when evaluation is abandoned by an exception)
+		 */
+		void unwind(void);
+
+	protected:
+
+		/*
+		 * Append folded stacks below a given call tree node
+		 * @param stream output stream reference
+		 * @param node call tree node index
+		 * @param prefix call stack prefix string reference
+		 */
+		void _fold_call_node(
+			std::stringstream &stream,
+			size_t node,
+			const std::string &prefix
+			);
+
+		/*
+		 * Profiler status
+		 */
+		bool _enabled;
+
+		/*
+		 * Active function call frames
+		 */
+		std::vector<prf_call_frame> _call_frames;
+
+		/*
+		 * Function call samples, keyed by name atom, and call tree
+		 */
+		std::map<size_t, prf_call> _calls;
+		std::vector<prf_call_node> _call_tree;
+
+		/*
+		 * Active statement frames
+		 */
+		std::vector<prf_frame> _frames;
+
+		/*
+		 * Profiler samples, keyed by line and by line/position
+		 */
+		std::map<size_t, prf_entry> _lines;
+		std::map<std::pair<size_t, size_t>, prf_entry> _statements;
+
+		/*
+		 * Total time spent in top-level statements
+		 */
+		unsigned long long _total;
+
+} prf, *prf_ptr;
+
+#endif
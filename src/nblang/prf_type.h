@@ -0,0 +1,87 @@
+/*
+ * prf_type.h
+ * Copyright (C) 2013 David Jolly
+ * ----------------------
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef PRF_TYPE_H_
+#define PRF_TYPE_H_
+
+#include <string>
+
+class _prf;
+typedef _prf prf, *prf_ptr;
+
+/*
+ * Profiler exception types
+ */
+enum {
+	PRF_EXC_NO_ACTIVE_CALL = 0,
+	PRF_EXC_NO_ACTIVE_STATEMENT,
+};
+
+/*
+ * Max profiler types
+ */
+#define MAX_PRF_EXC_TYPE PRF_EXC_NO_ACTIVE_STATEMENT
+
+/*
+ * Profiler report limits
+ * (non-verbose reports only list the hottest lines and functions)
+ */
+#define PRF_REPORT_CALL_COUNT 0x10
+#define PRF_REPORT_LINE_COUNT 0x20
+
+/*
+ * Profiler folded-stack unit, in nanoseconds
+ * (stacks are written in whole microseconds, rounded up)
+ */
+#define PRF_FOLD_UNIT 1000ULL
+
+/*
+ * Profiler call tree root node
+ */
+#define PRF_CALL_ROOT 0
+
+/*
+ * Profiler strings
+ */
+static const std::string PRF_EXC_STR[] = {
+	"No active call to exit",
+	"No active statement to exit",
+};
+
+/*
+ * Profiler string lookup macros
+ */
+#define PRF_EXC_STRING(_T_) (_T_ > MAX_PRF_EXC_TYPE ? "Unknown profiler exception type" : PRF_EXC_STR[_T_])
+
+/*
+ * Profiler exception macros
+ */
+#define THROW_PRF_EXC(_T_) {\
+	std::stringstream ss;\
+	ss << PRF_EXC_STRING(_T_);\
+	throw std::runtime_error(ss.str().c_str());\
+	}
+	
+#define THROW_PRF_EXC_W_MESS(_M_, _T_) {\
+	std::stringstream ss;\
+	ss << PRF_EXC_STRING(_T_) << ": " << _M_;\
+	throw std::runtime_error(ss.str().c_str());\
+	}
+
+#endif
@@ -0,0 +1,211 @@
+/*
+ * sta.cpp
+ * Copyright (C) 2013 David Jolly
+ * ----------------------
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <cstring>
+#include <iomanip>
+#include <sstream>
+#include <stdexcept>
+#include "sta.h"
+
+//#define STA_TRACING
+#ifndef STA_TRACING
+#define TRACE_SUBSYSTEM TRC_SUBSYSTEM_EXECUTOR
+#include "trace.h"
+#else
+#define TRACE_HEADER "sta"
+#include "trace.h"
+#endif
+
+_sta::_sta(void) :
+	_enabled(false)
+{
+	TRACE_EVENT("+_sta::_sta", TRACE_TYPE_INFORMATION);
+
+	clear();
+
+	TRACE_EVENT("-_sta::_sta", TRACE_TYPE_INFORMATION);
+}
+
+_sta::_sta(
+	const _sta &other
+	) :
+		_enabled(other._enabled)
+{
+	TRACE_EVENT("+_sta::_sta", TRACE_TYPE_INFORMATION);
+
+	memcpy(_counters, other._counters, sizeof(unsigned long long) * (MAX_STA_COUNTER_TYPE + 1));
+	memcpy(_statements, other._statements, sizeof(unsigned long long) * (MAX_TOKEN_TYPE + 1));
+
+	TRACE_EVENT("-_sta::_sta", TRACE_TYPE_INFORMATION);
+}
+
+_sta::~_sta(void)
+{
+	TRACE_EVENT("+_sta::~_sta", TRACE_TYPE_INFORMATION);
+	TRACE_EVENT("-_sta::~_sta", TRACE_TYPE_INFORMATION);
+}
+
+_sta &
+_sta::operator=(
+	const _sta &other
+	)
+{
+	TRACE_EVENT("+_sta::operator=", TRACE_TYPE_INFORMATION);
+
+	if(this != &other) {
+		_enabled = other._enabled;
+		memcpy(_counters, other._counters, sizeof(unsigned long long) * (MAX_STA_COUNTER_TYPE + 1));
+		memcpy(_statements, other._statements, sizeof(unsigned long long) * (MAX_TOKEN_TYPE + 1));
+	}
+
+	TRACE_EVENT("-_sta::operator=", TRACE_TYPE_INFORMATION);
+
+	return *this;
+}
+
+void 
+_sta::add(
+	size_t type,
+	size_t count
+	)
+{
+
+	if(type <= MAX_STA_COUNTER_TYPE) {
+		_counters[type] += count;
+	}
+}
+
+void 
+_sta::add_statement(
+	size_t type
+	)
+{
+
+	if(type <= MAX_TOKEN_TYPE) {
+		++_statements[type];
+	}
+	++_counters[STA_COUNTER_STATEMENT];
+}
+
+void 
+_sta::clear(void)
+{
+	TRACE_EVENT("+_sta::clear", TRACE_TYPE_INFORMATION);
+
+	memset(_counters, 0, sizeof(unsigned long long) * (MAX_STA_COUNTER_TYPE + 1));
+	memset(_statements, 0, sizeof(unsigned long long) * (MAX_TOKEN_TYPE + 1));
+
+	TRACE_EVENT("-_sta::clear", TRACE_TYPE_INFORMATION);
+}
+
+unsigned long long 
+_sta::get(
+	size_t type
+	)
+{
+	return (type <= MAX_STA_COUNTER_TYPE) ? _counters[type] : 0;
+}
+
+unsigned long long 
+_sta::get_statement(
+	size_t type
+	)
+{
+	return (type <= MAX_TOKEN_TYPE) ? _statements[type] : 0;
+}
+
+bool 
+_sta::is_enabled(void)
+{
+	return _enabled;
+}
+
+void 
+_sta::set_enabled(
+	bool enabled
+	)
+{
+	TRACE_EVENT("+_sta::set_enabled", TRACE_TYPE_INFORMATION);
+
+	_enabled = enabled;
+
+	TRACE_EVENT("-_sta::set_enabled", TRACE_TYPE_INFORMATION);
+}
+
+std::string 
+_sta::to_json(void)
+{
+	TRACE_EVENT("+_sta::to_json", TRACE_TYPE_INFORMATION);
+
+	size_t type = 0;
+	std::stringstream ss;
+	bool first = true;
+
+	ss << "{";
+
+	for(; type <= MAX_STA_COUNTER_TYPE; ++type) {
+		ss << "\"" << STA_COUNTER_STRING(type) << "\": " << _counters[type] << ", ";
+	}
+	ss << "\"statement_types\": {";
+
+	for(type = 0; type <= MAX_TOKEN_TYPE; ++type) {
+
+		if(_statements[type]) {
+			ss << (first ? "" : ", ") << "\"" << TOKEN_TYPE_STRING(type) << "\": " << _statements[type];
+			first = false;
+		}
+	}
+	ss << "}}";
+
+	TRACE_EVENT("-_sta::to_json", TRACE_TYPE_INFORMATION);
+
+	return ss.str();
+}
+
+std::string 
+_sta::to_string(
+	bool verbose
+	)
+{
+	TRACE_EVENT("+_sta::to_string", TRACE_TYPE_INFORMATION);
+
+	size_t type = 0;
+	std::stringstream ss;
+
+	ss << "Statistics:";
+
+	for(; type <= MAX_STA_COUNTER_TYPE; ++type) {
+		ss << std::endl << std::setw(16) << _counters[type] << "  " << STA_COUNTER_STRING(type);
+	}
+
+	if(verbose) {
+		ss << std::endl << std::endl << std::setw(16) << "count" << "  statement";
+
+		for(type = 0; type <= MAX_TOKEN_TYPE; ++type) {
+
+			if(_statements[type]) {
+				ss << std::endl << std::setw(16) << _statements[type] << "  " << TOKEN_TYPE_STRING(type);
+			}
+		}
+	}
+
+	TRACE_EVENT("-_sta::to_string", TRACE_TYPE_INFORMATION);
+
+	return ss.str();
+}
@@ -0,0 +1,152 @@
+/*
+ * sta.h
+ * Copyright (C) 2013 David Jolly
+ * ----------------------
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef STA_H_
+#define STA_H_
+
+#include "lang.h"
+#include "sta_type.h"
+
+/*
+ * Statistics class
+ * (cheap execution counters, kept for the lifetime of an executor once
+ * enabled; allocated bytes are estimated from the values copied into
+ * variables)
+ */
+typedef class _sta {
+
+	public:
+
+		/*
+		 * Statistics constructor
+		 */
+		_sta(void);
+
+		/*
+		 * Statistics constructor
+		 * @param other statistics object reference
+		 */
+		_sta(
+			const _sta &other
+			);
+
+		/*
+		 * Statistics destructor
+		 */
+		virtual ~_sta(void);
+
+		/*
+		 * Statistics assignment operator
+		 * @param other statistics object reference
+		 * @return statistics object reference
+		 */
+		_sta &operator=(
+			const _sta &other
+			);
+
+		/*
+		 * Add to a counter
+		 * @param type counter type
+		 * @param count amount to add
+		 */
+		void add(
+			size_t type,
+			size_t count
+			);
+
+		/*
+		 * Add an executed statement
+		 * @param type statement token type
+		 */
+		void add_statement(
+			size_t type
+			);
+
+		/*
+		 * Clear all counters
+		 */
+		void clear(void);
+
+		/*
+		 * Retrieve a counter
+		 * @param type counter type
+		 * @return counter value
+		 */
+		unsigned long long get(
+			size_t type
+			);
+
+		/*
+		 * Retrieve an executed statement count
+		 * @param type statement token type
+		 * @return executed statement count
+		 */
+		unsigned long long get_statement(
+			size_t type
+			);
+
+		/*
+		 * Retrieve enabled status
+		 * @return true if enabled, false otherwise
+		 */
+		bool is_enabled(void);
+
+		/*
+		 * Set enabled status
+		 * @param enabled enabled status
+		 */
+		void set_enabled(
+			bool enabled
+			);
+
+		/*
+		 * Retrieve JSON represenation
+		 * @return JSON represenation
+		 */
+		std::string to_json(void);
+
+		/*
+		 * Retrieve string represenation
+		 * @param verbose verbose string status
+		 * @return string represenation
+		 */
+		std::string to_string(
+			bool verbose
+			);
+
+	protected:
+
+		/*
+		 * Statistics counters
+		 */
+		unsigned long long _counters[MAX_STA_COUNTER_TYPE + 1];
+
+		/*
+		 * Statistics enabled status
+		 */
+		bool _enabled;
+
+		/*
+		 * Executed statement counters, indexed by token type
+		 */
+		unsigned long long _statements[MAX_TOKEN_TYPE + 1];
+
+} sta, *sta_ptr;
+
+#endif
@@ -0,0 +1,58 @@
+/*
+ * sta_type.h
+ * Copyright (C) 2013 David Jolly
+ * ----------------------
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef STA_TYPE_H_
+#define STA_TYPE_H_
+
+#include <string>
+
+class _sta;
+typedef _sta sta, *sta_ptr;
+
+/*
+ * Statistics counter types
+ */
+enum {
+	STA_COUNTER_ALLOCATED = 0,
+	STA_COUNTER_COPIED,
+	STA_COUNTER_EXPRESSION,
+	STA_COUNTER_FILE_OPEN,
+	STA_COUNTER_MODULE,
+	STA_COUNTER_SCOPE,
+	STA_COUNTER_STATEMENT,
+};
+
+/*
+ * Max statistics types
+ */
+#define MAX_STA_COUNTER_TYPE STA_COUNTER_STATEMENT
+
+/*
+ * Statistics strings
+ */
+static const std::string STA_COUNTER_STR[] = {
+	"bytes_allocated", "values_copied", "expressions", "file_opens", "modules", "scopes", "statements",
+};
+
+/*
+ * Statistics string lookup macros
+ */
+#define STA_COUNTER_STRING(_T_) (_T_ > MAX_STA_COUNTER_TYPE ? "unknown" : STA_COUNTER_STR[_T_])
+
+#endif
@@ -17,20 +17,24 @@
  * along with this program.  If not, see <http://www.gnu.org/licenses/>.
  */
 
+#include <algorithm>
+#include <cstdlib>
 #include <sstream>
 #include <stdexcept>
 #include "lang.h"
 #include "tok.h"
 #include "tok_type.h"
 
-_tok::_tok(void)
+_tok::_tok(void) :
+	_s_src(0)
 {
 	clear();
 }
 
 _tok::_tok(
 	size_t class_type
-	)
+	) :
+		_s_src(0)
 {
 	clear();
 	_class_type = class_type;
@@ -46,14 +50,23 @@ _tok::_tok(
 		_type(other._type),
 		_f_val(other._f_val),
 		_i_val(other._i_val),
-		_s_val(other._s_val)
+		_s_val(other._s_val),
+		_s_src(other._s_src)
 {
-	return;
+	buf_ptr buffer = _get_buffer();
+
+	if(buffer) {
+		buffer->reference();
+	}
 }
 
 _tok::~_tok(void)
 {
-	return;
+	buf_ptr buffer = _get_buffer();
+
+	if(buffer) {
+		buffer->release();
+	}
 }
 
 _tok &
@@ -61,6 +74,8 @@ _tok::operator=(
 	const _tok &other
 	)
 {
+	buf_ptr buffer;
+
 	if(this != &other) {
 		_class_type = other._class_type;
 		_line = other._line;
@@ -70,11 +85,65 @@ _tok::operator=(
 		_f_val = other._f_val;
 		_i_val = other._i_val;
 		_s_val = other._s_val;
+		buffer = other._get_buffer();
+
+		if(buffer) {
+			buffer->reference();
+		}
+		buffer = _get_buffer();
+
+		if(buffer) {
+			buffer->release();
+		}
+		_s_src = other._s_src;
 	}
 
 	return *this;
 }
 
+buf_ptr 
+_tok::_get_buffer(void) const
+{
+	return (_s_src & TOK_SOURCE_ATOM) ? NULL : (buf_ptr) _s_src;
+}
+
+void 
+_tok::_set_text(
+	const std::string &value
+	)
+{
+	buf_ptr buffer = _get_buffer();
+
+	if(buffer) {
+		buffer->release();
+	}
+	_s_src = 0;
+	_s_val = value;
+}
+
+void 
+_tok::append(
+	const char *data,
+	size_t length
+	)
+{
+	buf_ptr buffer = _get_buffer();
+
+	if(_class_type != CLASS_TOKEN_TYPE_TOKEN) {
+		THROW_TOK_EXC_W_MESS(_class_type, TOK_EXC_INVALID_CLS_TYPE);
+	}
+
+	if(buffer) {
+		buffer->validate();
+		_s_val.assign(buffer->get_data(), buffer->get_size());
+		buffer->release();
+	} else if(_s_src) {
+		_s_val = atm::get_text(get_atom());
+	}
+	_s_src = 0;
+	_s_val.append(data, length);
+}
+
 void 
 _tok::ceiling(void)
 {
@@ -102,7 +171,7 @@ _tok::ceiling(void)
 	}
 	_f_val = value;
 	_i_val = (long) value;
-	_s_val = ss.str();
+	_set_text(ss.str());
 }
 
 void 
@@ -115,7 +184,7 @@ _tok::clear(void)
 	_type = INVALID_TYPE;
 	_f_val = 0.0;
 	_i_val = 0;
-	_s_val.clear();
+	_set_text(std::string());
 }
 
 void 
@@ -145,45 +214,101 @@ _tok::floor(void)
 	}
 	_f_val = value;
 	_i_val = (long) value;
-	_s_val = ss.str();
+	_set_text(ss.str());
 }
 
 size_t 
-_tok::get_class_type(void)
+_tok::get_atom(void) const
+{
+	return (_s_src & TOK_SOURCE_ATOM) ? (size_t) (_s_src >> 1) : ATM_INVALID_ID;
+}
+
+size_t 
+_tok::get_class_type(void) const
 {
 	return _class_type;
 }
 
 size_t 
-_tok::get_line(void)
+_tok::get_line(void) const
 {
 	return _line;
 }
 
 size_t 
-_tok::get_position(void)
+_tok::get_position(void) const
 {
 	return _position;
 }
 
 size_t 
-_tok::get_subtype(void)
+_tok::get_subtype(void) const
 {
 	return _subtype;
 }
 
 size_t 
-_tok::get_type(void)
+_tok::get_type(void) const
 {
 	return _type;
 }
 
 std::string 
-_tok::get_text(void)
+_tok::get_text(void) const
 {
+	buf_ptr buffer = _get_buffer();
+
+	if(_s_src & TOK_SOURCE_ATOM) {
+		return atm::get_text(get_atom());
+	}
+
+	if(buffer) {
+		buffer->validate();
+
+		return buffer->to_string();
+	}
+
 	return _s_val;
 }
 
+const char *
+_tok::get_text_data(
+	size_t &length
+	) const
+{
+	buf_ptr buffer = _get_buffer();
+
+	if(_s_src & TOK_SOURCE_ATOM) {
+		const std::string &text = atm::get_text(get_atom());
+
+		length = text.size();
+
+		return text.c_str();
+	}
+
+	if(buffer) {
+		buffer->validate();
+		length = buffer->get_size();
+
+		return buffer->get_data();
+	}
+	length = _s_val.size();
+
+	return _s_val.c_str();
+}
+
+size_t 
+_tok::get_text_length(void) const
+{
+	buf_ptr buffer = _get_buffer();
+
+	if(_s_src & TOK_SOURCE_ATOM) {
+		return atm::get_text(get_atom()).size();
+	}
+
+	return buffer ? buffer->get_size() : _s_val.size();
+}
+
 void 
 _tok::negate(void)
 {
@@ -206,7 +331,7 @@ _tok::negate(void)
 	}
 	_f_val = value;
 	_i_val = (long) value;
-	_s_val = ss.str();
+	_set_text(ss.str());
 }
 
 void 
@@ -237,7 +362,7 @@ _tok::randomize(
 	}
 	_f_val = value;
 	_i_val = (long) value;
-	_s_val = ss.str();
+	_set_text(ss.str());
 }
 
 void 
@@ -267,7 +392,20 @@ _tok::round(void)
 	}
 	_f_val = value;
 	_i_val = (long) value;
-	_s_val = ss.str();
+	_set_text(ss.str());
+}
+
+void 
+_tok::set_atom(
+	size_t id
+	)
+{
+	_set_text(std::string());
+	std::string().swap(_s_val);
+
+	if(id != ATM_INVALID_ID) {
+		_s_src = (((uintptr_t) id) << 1) | TOK_SOURCE_ATOM;
+	}
 }
 
 void 
@@ -331,7 +469,7 @@ _tok::set_value(
 	ss << (double) value;
 	_f_val = value;
 	_i_val = (long) value;
-	_s_val = ss.str();
+	_set_text(ss.str());
 }
 
 void 
@@ -344,7 +482,7 @@ _tok::set_value(
 	ss << (long) value;
 	_f_val = value;
 	_i_val = value;
-	_s_val = ss.str();
+	_set_text(ss.str());
 }
 
 void 
@@ -354,7 +492,24 @@ _tok::set_value(
 {
 	_f_val = std::atof(value.c_str());
 	_i_val = std::atoi(value.c_str());
-	_s_val = value;
+	_set_text(value);
+}
+
+void 
+_tok::set_value(
+	buf_ptr value
+	)
+{
+	std::string prefix;
+
+	if(value) {
+		value->reference();
+		prefix.assign(value->get_data(), std::min(value->get_size(), (size_t) TOK_BUF_NUMERIC_PREFIX));
+	}
+	_set_text(std::string());
+	_s_src = (uintptr_t) value;
+	_f_val = std::atof(prefix.c_str());
+	_i_val = std::atoi(prefix.c_str());
 }
 
 void 
@@ -369,7 +524,7 @@ _tok::shift_left(
 	ss << (long) value;
 	_f_val = value;
 	_i_val = value;
-	_s_val = ss.str();
+	_set_text(ss.str());
 }
 
 void 
@@ -384,11 +539,11 @@ _tok::shift_right(
 	ss << (long) value;
 	_f_val = value;
 	_i_val = value;
-	_s_val = ss.str();
+	_set_text(ss.str());
 }
 
 double 
-_tok::to_float(void)
+_tok::to_float(void) const
 {
 	if(_class_type != CLASS_TOKEN_TYPE_TOKEN
 			|| (_type != TOKEN_TYPE_INTEGER
@@ -400,7 +555,7 @@ _tok::to_float(void)
 }
 
 long 
-_tok::to_integer(void)
+_tok::to_integer(void) const
 {
 	if(_class_type != CLASS_TOKEN_TYPE_TOKEN
 			|| (_type != TOKEN_TYPE_INTEGER
@@ -414,7 +569,7 @@ _tok::to_integer(void)
 std::string 
 _tok::to_string(
 	bool verbose
-	)
+	) const
 {
 	std::string subtype;
 	std::stringstream ss;
@@ -434,13 +589,13 @@ _tok::to_string(
 					ss << " " << _f_val;
 					break;
 				case TOKEN_TYPE_IDENTIFIER:
-					ss << " " << _s_val;
+					ss << " " << get_text();
 					break;
 				case TOKEN_TYPE_INTEGER:
 					ss << " " << _i_val;
 					break;
 				case TOKEN_TYPE_VAR_STRING:
-					ss << " \'" << _s_val << "\'";
+					ss << " \'" << get_text() << "\'";
 					break;
 			}
 
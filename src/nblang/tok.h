@@ -20,7 +20,10 @@
 #ifndef TOK_H_
 #define TOK_H_
 
+#include <cstdint>
 #include <string>
+#include "atm.h"
+#include "buf.h"
 
 /*
  * Token class
@@ -64,6 +67,16 @@ typedef class _tok {
 			const _tok &other
 			);
 
+		/*
+		 * Append text to token value in place
+		 * @param data text data pointer
+		 * @param length text data length
+		 */
+		void append(
+			const char *data,
+			size_t length
+			);
+
 		/*
 		 * Ceiling token value
 		 */
@@ -79,41 +92,65 @@ typedef class _tok {
 		 */
 		void floor(void);
 
+		/*
+		 * Retrieve token atom id
+		 * (identifier text is interned when the lexer creates the token)
+		 * @return token atom id, ATM_INVALID_ID if the text is not interned
+		 */
+		size_t get_atom(void) const;
+
 		/*
 		 * Retrieve token class type
 		 * @return token class type
 		 */
-		size_t get_class_type(void);
+		size_t get_class_type(void) const;
 
 		/*
 		 * Retrieve token line number
 		 * @return token line number
 		 */
-		size_t get_line(void);
+		size_t get_line(void) const;
 
 		/*
 		 * Retrieve token line position
 		 * @return token line position
 		 */
-		size_t get_position(void);
+		size_t get_position(void) const;
 
 		/*
 		 * Retrieve token subtype
 		 * @return token subtype
 		 */
-		size_t get_subtype(void);
+		size_t get_subtype(void) const;
 
 		/*
 		 * Retrieve token type
 		 * @return token type
 		 */
-		size_t get_type(void);
+		size_t get_type(void) const;
 
 		/*
 		 * Retrieve token text reference
 		 * @return token text reference
 		 */
-		std::string get_text(void);
+		std::string get_text(void) const;
+
+		/*
+		 * Retrieve token text data and length without copying
+		 * (a mapped file buffer is validated once, so both stay consistent)
+		 * @param length token text length reference
+		 * @return token text data pointer
+		 */
+		const char *get_text_data(
+			size_t &length
+			) const;
+
+		/*
+		 * Retrieve token text length
+		 * (a mapped file buffer is not validated)
+		 * @return token text length
+		 */
+		size_t get_text_length(void) const;
 
 		/*
 		 * Negate token value
@@ -133,6 +170,15 @@ typedef class _tok {
 		 */
 		void round(void);
 
+		/*
+		 * Set token text as an interned atom
+		 * (the token refers to the atom table rather than holding its own text)
+		 * @param id atom id
+		 */
+		void set_atom(
+			size_t id
+			);
+
 		/*
 		 * Set token as type of a given subtype
 		 * @param type token type
@@ -199,6 +245,15 @@ typedef class _tok {
 			const std::string value
 			);
 
+		/*
+		 * Set value as shared buffer
+		 * (the token takes its own buffer reference)
+		 * @param value buffer object pointer
+		 */
+		void set_value(
+			buf_ptr value
+			);
+
 		/* 
 		 * Set token type
 		 * @param type token type
@@ -226,12 +281,12 @@ typedef class _tok {
 		/*
 		 * Retrieve float representation of token value
 		 */
-		double to_float(void);
+		double to_float(void) const;
 
 		/*
 		 * Retrieve integer representation of token value
 		 */
-		long to_integer(void);
+		long to_integer(void) const;
 
 		/*
 		 * Retrieve string represenation
@@ -240,10 +295,24 @@ typedef class _tok {
 		 */
 		std::string to_string(
 			bool verbose
-			);
+			) const;
 
 	protected:
 
+		/*
+		 * Retrieve shared token text buffer
+		 * @return shared buffer pointer, NULL if the text is not buffered
+		 */
+		buf_ptr _get_buffer(void) const;
+
+		/*
+		 * Set token text, releasing any shared buffer
+		 * @param value text string reference
+		 */
+		void _set_text(
+			const std::string &value
+			);
+
 		/*
 		 * Token type information
 		 */
@@ -260,6 +329,13 @@ typedef class _tok {
 		long _i_val;
 		std::string _s_val;
 
+		/*
+		 * Token text source
+		 * (zero when the text is held in _s_val, otherwise either a shared
+		 * buffer pointer or an atom id tagged with TOK_SOURCE_ATOM)
+		 */
+		uintptr_t _s_src;
+
 
 } tok, *tok_ptr;
 
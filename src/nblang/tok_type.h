@@ -40,6 +40,19 @@ enum {
  */
 #define MAX_TOK_EXC_TYPE TOK_EXC_NON_NUMERIC_TYPE
 
+/*
+ * Token buffer numeric prefix length
+ * (leading bytes of a buffer value parsed for its numeric value)
+ */
+#define TOK_BUF_NUMERIC_PREFIX 0x40
+
+/*
+ * Token text source tag
+ * (low bit of a text source holding an atom id shifted left by one;
+ * buffer pointers are allocated with at least two byte alignment)
+ */
+#define TOK_SOURCE_ATOM 1
+
 /*
  * Token strings
  */
@@ -52,9 +52,22 @@ static const std::string TRACE_TYPE_STR[] = {
 
 /* 
  * Trace event macros
- * Under Windows, visible from debugview; else visible from stderr stream
+ * With a trace subsystem, events are recorded into the runtime tracer ring
+ * buffers when that subsystem level allows (compiled out if NO_RUNTIME_TRACING
+ * is defined); else, under Windows, visible from debugview, or visible from
+ * stderr stream
+ * (messages must begin with a string literal, which is kept by pointer)
  */
-#ifdef _WIN32
+#if defined(TRACE_SUBSYSTEM) && !defined(NO_RUNTIME_TRACING)
+#include "trc.h"
+#define TRACE_EVENT(_M_, _T_) {\
+	if(trc::is_enabled(TRACE_SUBSYSTEM, _T_)) {\
+		trc::record(TRACE_SUBSYSTEM, _T_, trc_msg(true) << "" _M_);\
+	}\
+	}
+#elif defined(TRACE_SUBSYSTEM)
+#define TRACE_EVENT(_M_, _T_)
+#elif defined(_WIN32)
 #define WIN32_LEAN_AND_MEAN
 #define NOCOMM
 #include <Windows.h>
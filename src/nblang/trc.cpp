@@ -0,0 +1,427 @@
+/*
+ * trc.cpp
+ * Copyright (C) 2013 David Jolly
+ * ----------------------
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <algorithm>
+#include <csignal>
+#include <cstdlib>
+#include <cstring>
+#include <exception>
+#include <iomanip>
+#include <iostream>
+#include <stdexcept>
+#include "clk.h"
+#include "trace.h"
+#include "trc.h"
+
+/*
+ * Calling thread ring buffer
+ */
+static TRC_THREAD_LOCAL trc_ring_ptr trc_thread_ring = NULL;
+
+std::atomic<unsigned long long> _trc::_cleared(0);
+std::atomic<size_t> _trc::_levels[MAX_TRC_SUBSYSTEM_TYPE + 1];
+std::mutex _trc::_lock;
+std::vector<trc_ring_ptr> _trc::_rings;
+
+/*
+ * Compare tracer events by timestamp
+ * @param left left event reference
+ * @param right right event reference
+ * @return true if left was recorded before right, false otherwise
+ */
+static bool 
+trc_compare_time(
+	const std::pair<size_t, trc_event> &left,
+	const std::pair<size_t, trc_event> &right
+	)
+{
+	return left.second.time < right.second.time;
+}
+
+/*
+ * Write text to stderr from a signal handler
+ * @param text text pointer
+ */
+static void 
+trc_crash_write_text(
+	const char *text
+	)
+{
+	size_t length = 0;
+
+	while(text[length]) {
+		++length;
+	}
+
+	if(length) {
+		TRC_CRASH_WRITE(text, length);
+	}
+}
+
+/*
+ * Write an unsigned value to stderr from a signal handler
+ * @param value unsigned value
+ */
+static void 
+trc_crash_write_value(
+	unsigned long long value
+	)
+{
+	char buffer[TRC_CRASH_VALUE_LENGTH];
+	size_t index = TRC_CRASH_VALUE_LENGTH;
+
+	buffer[--index] = '\0';
+
+	do {
+		buffer[--index] = (char) ('0' + (value % 10));
+		value /= 10;
+	} while(value
+			&& index);
+	trc_crash_write_text(buffer + index);
+}
+
+/*
+ * Find a string in a given string table
+ * @param table string table pointer
+ * @param count string table length
+ * @param text text string reference
+ * @return string table index, count if not found
+ */
+static size_t 
+trc_find_string(
+	const std::string *table,
+	size_t count,
+	const std::string &text
+	)
+{
+	size_t result = 0;
+
+	for(; result < count; ++result) {
+
+		if(table[result] == text) {
+			break;
+		}
+	}
+
+	return result;
+}
+
+_trc_msg::_trc_msg(void) :
+	_text(NULL),
+	_literal(false)
+{
+	return;
+}
+
+_trc_msg::_trc_msg(
+	bool literal
+	) :
+		_text(NULL),
+		_literal(literal)
+{
+	return;
+}
+
+_trc_msg::~_trc_msg(void)
+{
+	return;
+}
+
+const std::string &
+_trc_msg::get_detail(void) const
+{
+	return _detail;
+}
+
+const char *
+_trc_msg::get_text(void) const
+{
+	return _text;
+}
+
+_trc::_trc(void)
+{
+	return;
+}
+
+void 
+_trc::_crash_signal(
+	int signal
+	)
+{
+	size_t index, tail;
+	unsigned long long cleared = _cleared.load(std::memory_order_relaxed);
+
+	if(trc_thread_ring) {
+		tail = trc_thread_ring->tail.load(std::memory_order_relaxed);
+		index = (tail > TRC_RING_LENGTH) ? (tail - TRC_RING_LENGTH) : 0;
+		trc_crash_write_text("Trace (signal ");
+		trc_crash_write_value((unsigned long long) signal);
+		trc_crash_write_text("): thread ");
+		trc_crash_write_value(trc_thread_ring->thread);
+
+		for(; index < tail; ++index) {
+			const trc_event &event = trc_thread_ring->event[index & (TRC_RING_LENGTH - 1)];
+
+			if(event.time < cleared) {
+				continue;
+			}
+			trc_crash_write_text("\n");
+			trc_crash_write_value(event.time);
+			trc_crash_write_text("ns");
+
+			if(event.subsystem <= MAX_TRC_SUBSYSTEM_TYPE) {
+				trc_crash_write_text("  ");
+				trc_crash_write_text(TRC_SUBSYSTEM_STR[event.subsystem].c_str());
+			}
+
+			if(event.type <= MAX_TRACE_TYPE) {
+				trc_crash_write_text("  ");
+				trc_crash_write_text(TRACE_TYPE_STR[event.type].c_str());
+			}
+			trc_crash_write_text("  ");
+
+			if(event.text) {
+				trc_crash_write_text(event.text);
+			}
+			trc_crash_write_text(event.detail);
+		}
+		trc_crash_write_text("\n\n");
+	}
+	std::signal(signal, SIG_DFL);
+	std::raise(signal);
+}
+
+void 
+_trc::_crash_terminate(void)
+{
+	std::stringstream ss;
+
+	if(_lock.try_lock()) {
+		_to_string(ss);
+		_lock.unlock();
+		std::cerr << ss.str() << std::endl;
+	}
+	std::abort();
+}
+
+trc_ring_ptr 
+_trc::_get_ring(void)
+{
+
+	if(!trc_thread_ring) {
+		std::lock_guard<std::mutex> guard(_lock);
+
+		trc_thread_ring = new trc_ring;
+		trc_thread_ring->thread = _rings.size();
+		trc_thread_ring->tail.store(0, std::memory_order_relaxed);
+		_rings.push_back(trc_thread_ring);
+	}
+
+	return trc_thread_ring;
+}
+
+void 
+_trc::_to_string(
+	std::stringstream &stream
+	)
+{
+	size_t i = 0, index, tail, first;
+	std::vector<trc_event> ring_events;
+	unsigned long long cleared = _cleared.load(std::memory_order_relaxed), start = 0;
+	std::vector<std::pair<size_t, trc_event>> events;
+
+	for(; i < _rings.size(); ++i) {
+		tail = _rings.at(i)->tail.load(std::memory_order_acquire);
+		first = (tail > TRC_RING_LENGTH) ? (tail - TRC_RING_LENGTH) : 0;
+		ring_events.resize(tail - first);
+
+		for(index = first; index < tail; ++index) {
+			memcpy(&ring_events.at(index - first), &_rings.at(i)->event[index & (TRC_RING_LENGTH - 1)], sizeof(trc_event));
+		}
+		std::atomic_thread_fence(std::memory_order_acquire);
+		tail = _rings.at(i)->tail.load(std::memory_order_relaxed);
+
+		for(index = first; index < (first + ring_events.size()); ++index) {
+
+			if(((index + TRC_RING_LENGTH) > tail)
+					&& (ring_events.at(index - first).time >= cleared)) {
+				events.push_back(std::pair<size_t, trc_event>(_rings.at(i)->thread, ring_events.at(index - first)));
+			}
+		}
+	}
+	std::stable_sort(events.begin(), events.end(), trc_compare_time);
+
+	if(!events.empty()) {
+		start = events.front().second.time;
+	}
+	stream << std::fixed << std::setprecision(3) << "Trace: " << events.size() << " events, " 
+		<< _rings.size() << " threads" << std::endl << std::setw(14) << "time us" << std::setw(8) << "thread" 
+		<< "  " << std::left << std::setw(10) << "subsystem" << std::setw(13) << "type" << "event" << std::right;
+
+	for(i = 0; i < events.size(); ++i) {
+		const trc_event &event = events.at(i).second;
+
+		stream << std::endl << std::setw(14) << ((event.time - start) / 1000.0) << std::setw(8) << events.at(i).first 
+			<< "  " << std::left << std::setw(10) << TRC_SUBSYSTEM_STRING(event.subsystem) 
+			<< std::setw(13) << TRACE_TYPE_STRING(event.type) << std::right << (event.text ? event.text : "") 
+			<< event.detail;
+	}
+}
+
+void 
+_trc::clear(void)
+{
+	_cleared.store(clk::now(), std::memory_order_relaxed);
+}
+
+void 
+_trc::configure(
+	const std::string &specification
+	)
+{
+#ifdef NO_RUNTIME_TRACING
+	THROW_TRC_EXC_W_MESS(specification, TRC_EXC_UNAVAILABLE);
+#else
+	std::string entry;
+	size_t delim, level, subsystem;
+	std::stringstream ss(specification);
+
+	while(std::getline(ss, entry, TRC_CONFIG_DELIM)) {
+
+		if(entry.empty()) {
+			continue;
+		}
+		level = TRC_LEVEL_VERBOSE;
+		delim = entry.find(TRC_CONFIG_LEVEL_DELIM);
+
+		if(delim != std::string::npos) {
+			level = trc_find_string(TRC_LEVEL_STR, MAX_TRC_LEVEL_TYPE + 1, entry.substr(delim + 1));
+
+			if(level > MAX_TRC_LEVEL_TYPE) {
+				THROW_TRC_EXC_W_MESS(entry.substr(delim + 1), TRC_EXC_INVALID_LEVEL);
+			}
+			entry = entry.substr(0, delim);
+		}
+
+		if(entry == TRC_CONFIG_ALL) {
+
+			for(subsystem = 0; subsystem <= MAX_TRC_SUBSYSTEM_TYPE; ++subsystem) {
+				set_level(subsystem, level);
+			}
+		} else {
+			subsystem = trc_find_string(TRC_SUBSYSTEM_STR, MAX_TRC_SUBSYSTEM_TYPE + 1, entry);
+
+			if(subsystem > MAX_TRC_SUBSYSTEM_TYPE) {
+				THROW_TRC_EXC_W_MESS(entry, TRC_EXC_INVALID_SUBSYSTEM);
+			}
+			set_level(subsystem, level);
+		}
+	}
+#endif
+}
+
+size_t 
+_trc::get_level(
+	size_t subsystem
+	)
+{
+
+	if(subsystem > MAX_TRC_SUBSYSTEM_TYPE) {
+		THROW_TRC_EXC_W_MESS(subsystem, TRC_EXC_INVALID_SUBSYSTEM);
+	}
+
+	return _levels[subsystem].load(std::memory_order_relaxed);
+}
+
+void 
+_trc::install_crash_handler(void)
+{
+	std::set_terminate(_crash_terminate);
+	std::signal(SIGABRT, _crash_signal);
+	std::signal(SIGFPE, _crash_signal);
+	std::signal(SIGILL, _crash_signal);
+	std::signal(SIGSEGV, _crash_signal);
+}
+
+bool 
+_trc::is_active(void)
+{
+	bool result = false;
+	size_t subsystem = 0;
+
+	for(; subsystem <= MAX_TRC_SUBSYSTEM_TYPE; ++subsystem) {
+
+		if(_levels[subsystem].load(std::memory_order_relaxed) != TRC_LEVEL_OFF) {
+			result = true;
+			break;
+		}
+	}
+
+	return result;
+}
+
+void 
+_trc::record(
+	size_t subsystem,
+	size_t type,
+	const trc_msg &message
+	)
+{
+	trc_ring_ptr ring = _get_ring();
+	size_t length = std::min(message.get_detail().size(), (size_t) (TRC_DETAIL_LENGTH - 1)), 
+		tail = ring->tail.load(std::memory_order_relaxed);
+	trc_event &event = ring->event[tail & (TRC_RING_LENGTH - 1)];
+
+	event.subsystem = subsystem;
+	event.text = message.get_text();
+	event.time = clk::now();
+	event.type = type;
+	memcpy(event.detail, message.get_detail().c_str(), length);
+	event.detail[length] = '\0';
+	ring->tail.store(tail + 1, std::memory_order_release);
+}
+
+void 
+_trc::set_level(
+	size_t subsystem,
+	size_t level
+	)
+{
+
+	if(subsystem > MAX_TRC_SUBSYSTEM_TYPE) {
+		THROW_TRC_EXC_W_MESS(subsystem, TRC_EXC_INVALID_SUBSYSTEM);
+	}
+
+	if(level > MAX_TRC_LEVEL_TYPE) {
+		THROW_TRC_EXC_W_MESS(level, TRC_EXC_INVALID_LEVEL);
+	}
+	_levels[subsystem].store(level, std::memory_order_relaxed);
+}
+
+std::string 
+_trc::to_string(void)
+{
+	std::stringstream ss;
+	std::lock_guard<std::mutex> guard(_lock);
+
+	_to_string(ss);
+
+	return ss.str();
+}
@@ -0,0 +1,320 @@
+/*
+ * trc.h
+ * Copyright (C) 2013 David Jolly
+ * ----------------------
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef TRC_H_
+#define TRC_H_
+
+#include <atomic>
+#include <mutex>
+#include <sstream>
+#include <vector>
+#include "trc_type.h"
+
+/*
+ * Tracer event
+ * (static text is held by pointer, so only formatted detail is copied)
+ */
+typedef struct _trc_event {
+
+	/*
+	 * Event text
+	 */
+	char detail[TRC_DETAIL_LENGTH];
+	const char *text;
+
+	/*
+	 * Event origin
+	 */
+	size_t subsystem;
+	size_t type;
+
+	/*
+	 * Event timestamp, in nanoseconds
+	 */
+	unsigned long long time;
+
+} trc_event, *trc_event_ptr;
+
+/*
+ * Tracer ring buffer
+ * (each ring has a single producer, its owning thread; rings outlive
+ * their threads so a dump still covers them)
+ */
+typedef struct _trc_ring {
+
+	/*
+	 * Ring events
+	 */
+	trc_event event[TRC_RING_LENGTH];
+
+	/*
+	 * Ring owner thread id
+	 */
+	size_t thread;
+
+	/*
+	 * Ring event count, advanced by the owner thread
+	 */
+	std::atomic<size_t> tail;
+
+} trc_ring, *trc_ring_ptr;
+
+/*
+ * Tracer message class
+ * (formats streamed values as detail text; a literal message keeps its
+ * leading string literal by pointer instead)
+ */
+typedef class _trc_msg {
+
+	public:
+
+		/*
+		 * Tracer message constructor
+		 */
+		_trc_msg(void);
+
+		/*
+		 * Tracer message constructor
+		 * @param literal true if the first streamed value is a string literal
+		 */
+		explicit _trc_msg(
+			bool literal
+			);
+
+		/*
+		 * Tracer message destructor
+		 */
+		virtual ~_trc_msg(void);
+
+		/*
+		 * Tracer message stream operator
+		 * @param text character array reference
+		 * @return tracer message object reference
+		 */
+		template <size_t N> _trc_msg &operator<<(
+			const char (&text)[N]
+			);
+
+		/*
+		 * Tracer message stream operator
+		 * @param value value reference
+		 * @return tracer message object reference
+		 */
+		template <class T> _trc_msg &operator<<(
+			const T &value
+			);
+
+		/*
+		 * Retrieve detail text
+		 * @return detail text string reference
+		 */
+		const std::string &get_detail(void) const;
+
+		/*
+		 * Retrieve static text
+		 * @return static text pointer, NULL if none
+		 */
+		const char *get_text(void) const;
+
+	protected:
+
+		/*
+		 * Tracer message text
+		 */
+		std::string _detail;
+		const char *_text;
+
+		/*
+		 * Tracer message literal status
+		 */
+		bool _literal;
+
+} trc_msg, *trc_msg_ptr;
+
+/*
+ * Tracer class
+ * (records compact events into per-thread ring buffers; each subsystem
+ * has its own level, which can be changed at runtime)
+ */
+typedef class _trc {
+
+	public:
+
+		/*
+		 * Clear all recorded events
+		 * (events older than the clear are skipped when dumped, so rings
+		 * are only ever written by their owning threads)
+		 */
+		static void clear(void);
+
+		/*
+		 * Configure subsystem levels from a given specification
+		 * (a comma-separated list of subsystem:level pairs, where
+		 * subsystem may be 'all' and level defaults to verbose; throws if
+		 * runtime tracing was compiled out)
+		 * @param specification specification string reference
+		 */
+		static void configure(
+			const std::string &specification
+			);
+
+		/*
+		 * Retrieve subsystem level
+		 * @param subsystem subsystem type
+		 * @return subsystem level type
+		 */
+		static size_t get_level(
+			size_t subsystem
+			);
+
+		/*
+		 * Install handlers which dump recorded events to stderr on crash
+		 */
+		static void install_crash_handler(void);
+
+		/*
+		 * Retrieve tracer status
+		 * @return true if any subsystem is traced, false otherwise
+		 */
+		static bool is_active(void);
+
+		/*
+		 * Retrieve trace type status for a given subsystem
+		 * @param subsystem subsystem type
+		 * @param type trace type
+		 * @return true if recorded, false otherwise
+		 */
+		static inline bool is_enabled(
+			size_t subsystem,
+			size_t type
+			)
+		{
+			return type < _levels[subsystem].load(std::memory_order_relaxed);
+		}
+
+		/*
+		 * Record an event for the calling thread
+		 * @param subsystem subsystem type
+		 * @param type trace type
+		 * @param message tracer message object reference
+		 */
+		static void record(
+			size_t subsystem,
+			size_t type,
+			const trc_msg &message
+			);
+
+		/*
+		 * Set subsystem level
+		 * @param subsystem subsystem type
+		 * @param level subsystem level type
+		 */
+		static void set_level(
+			size_t subsystem,
+			size_t level
+			);
+
+		/*
+		 * Retrieve string represenation
+		 * (events from all threads, ordered by timestamp)
+		 * @return string represenation
+		 */
+		static std::string to_string(void);
+
+	protected:
+
+		/*
+		 * Tracer constructor
+		 * (the tracer is only accessed through static routines)
+		 */
+		_trc(void);
+
+		/*
+		 * Crash handler routines
+		 * (the signal handler only uses async-signal-safe calls, so it
+		 * dumps the crashing thread's ring unsorted, without locking)
+		 */
+		static void _crash_signal(
+			int signal
+			);
+
+		static void _crash_terminate(void);
+
+		/*
+		 * Retrieve calling thread ring buffer, registering it on first use
+		 * @return ring buffer pointer
+		 */
+		static trc_ring_ptr _get_ring(void);
+
+		/*
+		 * Retrieve string represenation of recorded events
+		 * @param stream output stream reference
+		 */
+		static void _to_string(
+			std::stringstream &stream
+			);
+
+		/*
+		 * Timestamp of the last clear, in nanoseconds
+		 */
+		static std::atomic<unsigned long long> _cleared;
+
+		/*
+		 * Subsystem levels
+		 */
+		static std::atomic<size_t> _levels[MAX_TRC_SUBSYSTEM_TYPE + 1];
+
+		/*
+		 * Registered ring buffers
+		 */
+		static std::mutex _lock;
+		static std::vector<trc_ring_ptr> _rings;
+
+} trc, *trc_ptr;
+
+template <size_t N> _trc_msg &
+_trc_msg::operator<<(
+	const char (&text)[N]
+	)
+{
+
+	if(_literal) {
+		_literal = false;
+		_text = text;
+	} else {
+		_detail += text;
+	}
+
+	return *this;
+}
+
+template <class T> _trc_msg &
+_trc_msg::operator<<(
+	const T &value
+	)
+{
+	std::stringstream ss;
+
+	ss << value;
+	_detail += ss.str();
+
+	return *this;
+}
+
+#endif
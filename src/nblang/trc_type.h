@@ -0,0 +1,143 @@
+/*
+ * trc_type.h
+ * Copyright (C) 2013 David Jolly
+ * ----------------------
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef TRC_TYPE_H_
+#define TRC_TYPE_H_
+
+#include <string>
+
+class _trc;
+typedef _trc trc, *trc_ptr;
+
+/*
+ * Tracer exception types
+ */
+enum {
+	TRC_EXC_INVALID_LEVEL = 0,
+	TRC_EXC_INVALID_SUBSYSTEM,
+	TRC_EXC_UNAVAILABLE,
+};
+
+/*
+ * Tracer level types
+ * (a level records every trace type below it, so off records nothing
+ * and verbose records everything)
+ */
+enum {
+	TRC_LEVEL_OFF = 0,
+	TRC_LEVEL_ERROR,
+	TRC_LEVEL_WARNING,
+	TRC_LEVEL_INFORMATION,
+	TRC_LEVEL_VERBOSE,
+};
+
+/*
+ * Tracer subsystem types
+ */
+enum {
+	TRC_SUBSYSTEM_COMMON = 0,
+	TRC_SUBSYSTEM_EXECUTOR,
+	TRC_SUBSYSTEM_LEXER,
+	TRC_SUBSYSTEM_PARSER,
+	TRC_SUBSYSTEM_PROMPT,
+};
+
+/*
+ * Max tracer types
+ */
+#define MAX_TRC_EXC_TYPE TRC_EXC_UNAVAILABLE
+#define MAX_TRC_LEVEL_TYPE TRC_LEVEL_VERBOSE
+#define MAX_TRC_SUBSYSTEM_TYPE TRC_SUBSYSTEM_PROMPT
+
+/*
+ * Tracer ring buffer sizes
+ * (ring length must be a power of two)
+ */
+#define TRC_DETAIL_LENGTH 0x30
+#define TRC_RING_LENGTH 0x1000
+
+/*
+ * Tracer configuration symbols
+ */
+#define TRC_CONFIG_ALL "all"
+#define TRC_CONFIG_DELIM ','
+#define TRC_CONFIG_LEVEL_DELIM ':'
+
+/*
+ * Tracer thread-local storage
+ */
+#ifdef _WIN32
+#define TRC_THREAD_LOCAL __declspec(thread)
+#else
+#define TRC_THREAD_LOCAL __thread
+#endif
+
+/*
+ * Tracer crash output
+ * (an unbuffered, async-signal-safe write to stderr)
+ */
+#ifdef _WIN32
+#include <io.h>
+#define TRC_CRASH_WRITE(_B_, _L_) _write(2, _B_, (unsigned int) (_L_))
+#else
+#include <unistd.h>
+#define TRC_CRASH_WRITE(_B_, _L_) write(STDERR_FILENO, _B_, _L_)
+#endif
+#define TRC_CRASH_VALUE_LENGTH 0x18
+
+/*
+ * Tracer strings
+ */
+static const std::string TRC_EXC_STR[] = {
+	"Invalid trace level",
+	"Invalid trace subsystem",
+	"Runtime tracing is not available in this build (NO_RUNTIME_TRACING)",
+};
+
+static const std::string TRC_LEVEL_STR[] = {
+	"off", "error", "warning", "information", "verbose",
+};
+
+static const std::string TRC_SUBSYSTEM_STR[] = {
+	"common", "executor", "lexer", "parser", "prompt",
+};
+
+/*
+ * Tracer string lookup macros
+ */
+#define TRC_EXC_STRING(_T_) (_T_ > MAX_TRC_EXC_TYPE ? "Unknown tracer exception type" : TRC_EXC_STR[_T_])
+#define TRC_LEVEL_STRING(_T_) (_T_ > MAX_TRC_LEVEL_TYPE ? "Unknown tracer level type" : TRC_LEVEL_STR[_T_])
+#define TRC_SUBSYSTEM_STRING(_T_) (_T_ > MAX_TRC_SUBSYSTEM_TYPE ? "Unknown tracer subsystem type" : TRC_SUBSYSTEM_STR[_T_])
+
+/*
+ * Tracer exception macros
+ */
+#define THROW_TRC_EXC(_T_) {\
+	std::stringstream ss;\
+	ss << TRC_EXC_STRING(_T_);\
+	throw std::runtime_error(ss.str().c_str());\
+	}
+	
+#define THROW_TRC_EXC_W_MESS(_M_, _T_) {\
+	std::stringstream ss;\
+	ss << TRC_EXC_STRING(_T_) << ": " << _M_;\
+	throw std::runtime_error(ss.str().c_str());\
+	}
+
+#endif
@@ -20,9 +20,11 @@
 #ifndef TREE_H_
 #define TREE_H_
 
+#include <atomic>
 #include <queue>
 #include <sstream>
 #include <stdexcept>
+#include <vector>
 #include "node.h"
 #include "tree_type.h"
 
@@ -113,12 +115,24 @@ class _tree {
 		 */
 		T &get(void);
 
+		/* 
+		 * Retrieve current position node object reference
+		 * @return constant current position node object reference
+		 */
+		const T &get(void) const;
+
 		/* 
 		 * Retrieve current position node container object reference
 		 * @return current position node container object reference
 		 */
 		_node<T> *get_position_node(void);
 
+		/* 
+		 * Retrieve current position node container object reference
+		 * @return constant current position node container object reference
+		 */
+		const _node<T> *get_position_node(void) const;
+
 		/*
 		 * Retrieve current position node object child reference at a given index
 		 * @return current position node object child reference at a given index
@@ -127,20 +141,44 @@ class _tree {
 			size_t index
 			);
 
+		/*
+		 * Retrieve current position node object child reference at a given index
+		 * @return constant current position node object child reference at a given index
+		 */
+		const T &get_child(
+			size_t index
+			) const;
+
 		/* 
 		 * Retrieve current position node object child node count
 		 * @return current position node object child node count
 		 */
-		size_t get_child_count(void);
+		size_t get_child_count(void) const;
 
 		/*
 		 * Retrieve current position node container object pointer child at a given index
+		 * (the current position node is left unchanged)
 		 * @return current position node container object pointer child at a given index
 		 */
 		_node<T> *get_child_node(
 			size_t index
 			);
 
+		/*
+		 * Retrieve current position node container object pointer child at a given index
+		 * (the current position node is left unchanged)
+		 * @return constant current position node container object pointer child at a given index
+		 */
+		const _node<T> *get_child_node(
+			size_t index
+			) const;
+
+		/*
+		 * Retrieve the number of trees deep-copied, across all trees of this type
+		 * @return tree copy count
+		 */
+		static size_t get_copy_count(void);
+
 		/*
 		 * Retrieve root node object reference
 		 * @return root node object reference
@@ -148,22 +186,34 @@ class _tree {
 		T &get_root(void);
 
 		/*
-		 * Retrieve root node container object pointer child at a given index
-		 * @return root node container object pointer child at a given index
+		 * Retrieve root node object reference
+		 * @return constant root node object reference
+		 */
+		const T &get_root(void) const;
+
+		/*
+		 * Retrieve root node container object pointer
+		 * @return root node container object pointer
 		 */
 		_node<T> *get_root_node(void);
 
+		/*
+		 * Retrieve root node container object pointer
+		 * @return constant root node container object pointer
+		 */
+		const _node<T> *get_root_node(void) const;
+
 		/*
 		 * Retrieve current position node child status
 		 * @return true if not empty, false otherwise
 		 */
-		bool has_children(void);
+		bool has_children(void) const;
 
 		/*
 		 * Retrieve current position node parent status
 		 * @return true if has parent, false otherwise
 		 */
-		bool has_parent(void);
+		bool has_parent(void) const;
 
 		/*
 		 * Insert child into current position node at a given index
@@ -226,6 +276,17 @@ class _tree {
 		 */
 		void remove_children(void);
 
+		/*
+		 * Move other trees into current position node at a given index
+		 * (nodes are moved, not copied, and the other trees are left empty)
+		 * @param others tree object pointers
+		 * @param index child index
+		 */
+		void splice_child_nodes(
+			const std::vector<_tree<T> *> &others,
+			size_t index
+			);
+
 		/*
 		 * Retrieve string represenation
 		 * @param verbose verbose string status
@@ -237,6 +298,11 @@ class _tree {
 
 	protected:
 
+		/*
+		 * Tree copy count
+		 */
+		static std::atomic<size_t> _copy_count;
+
 		/*
 		 * Root node
 		 */
@@ -270,16 +336,19 @@ class _tree {
 		 * Retrieve current position node
 		 * @return current position node pointer
 		 */
-		_node<T> *_get_position(void);
+		_node<T> *_get_position(void) const;
 
 		/*
 		 * Retrieve root node
 		 * @return root node pointer
 		 */
-		_node<T> *_get_root(void);
+		_node<T> *_get_root(void) const;
 
 };
 
+template <class T>
+std::atomic<size_t> _tree<T>::_copy_count(0);
+
 template <class T>
 _tree<T>::_tree(void)
 {
@@ -350,14 +419,22 @@ _tree<T>::_clear_helper(
 	_node<T> **parent
 	)
 {
-	std::vector<_node<T> *>::iterator child;
+	_node<T> *curr = NULL;
+	std::vector<_node<T> *> pending;
+	typename _node<T>::child_iterator child;
 
 	if(*parent) {
+		pending.push_back(*parent);
+
+		while(!pending.empty()) {
+			curr = pending.back();
+			pending.pop_back();
 
-		for(child = (*parent)->get_child_begin(); child != (*parent)->get_child_end(); ++child) {
-			_clear_helper(&*child);
+			for(child = curr->get_child_begin(); child != curr->get_child_end(); ++child) {
+				pending.push_back(*child);
+			}
+			delete curr;
 		}
-		delete *parent;
 		*parent = NULL;
 	}
 }
@@ -368,20 +445,40 @@ _tree<T>::_copy_helper(
 	_node<T> *other
 	)
 {
-	_node<T> *entry = NULL;
-	std::vector<_node<T> *>::iterator child;
+	_node<T> *entry = NULL, *new_child = NULL;
+	typename _node<T>::child_iterator child;
+	std::vector<std::pair<_node<T> *, _node<T> *>> pending;
 
 	if(other) {
-		entry = new _node<T>(*other);
+		_copy_count.fetch_add(1, std::memory_order_relaxed);
+		entry = new _node<T>(other->get());
 		
 		if(!entry) {
 			THROW_TREE_EXC(TREE_EXC_OUT_OF_MEMORY);
 		}
 		entry->set_parent(parent);
-		entry->remove_children();
+		pending.push_back(std::pair<_node<T> *, _node<T> *>(other, entry));
+
+		try {
+
+			while(!pending.empty()) {
+				other = pending.back().first;
+				parent = pending.back().second;
+				pending.pop_back();
+
+				for(child = other->get_child_begin(); child != other->get_child_end(); ++child) {
+					new_child = new _node<T>((*child)->get());
 
-		for(child = other->get_child_begin(); child != other->get_child_end(); ++child) {
-			entry->insert_child(_copy_helper(entry, *child), entry->get_child_count());
+					if(!new_child) {
+						THROW_TREE_EXC(TREE_EXC_OUT_OF_MEMORY);
+					}
+					parent->add_child_back(new_child);
+					pending.push_back(std::pair<_node<T> *, _node<T> *>(*child, new_child));
+				}
+			}
+		} catch(...) {
+			_clear_helper(&entry);
+			throw;
 		}
 	}
 
@@ -389,7 +486,7 @@ _tree<T>::_copy_helper(
 }
 
 template <class T> _node<T> *
-_tree<T>::_get_position(void)
+_tree<T>::_get_position(void) const
 {
 	if(!_position) {
 		THROW_TREE_EXC(TREE_EXC_INVAL_POS_PTR);
@@ -399,7 +496,7 @@ _tree<T>::_get_position(void)
 }
 
 template <class T> _node<T> *
-_tree<T>::_get_root(void)
+_tree<T>::_get_root(void) const
 {
 	if(!_root) {
 		THROW_TREE_EXC(TREE_EXC_INVAL_ROOT_PTR);
@@ -456,12 +553,24 @@ _tree<T>::get(void)
 	return _position->get();
 }
 
+template <class T> const T &
+_tree<T>::get(void) const
+{
+	return _get_position()->get();
+}
+
 template <class T> _node<T> *
 _tree<T>::get_position_node(void)
 {
 	return _position;
 }
 
+template <class T> const _node<T> *
+_tree<T>::get_position_node(void) const
+{
+	return _position;
+}
+
 template <class T> T &
 _tree<T>::get_child(
 	size_t index
@@ -472,8 +581,18 @@ _tree<T>::get_child(
 	return child->get();
 };
 
+template <class T> const T &
+_tree<T>::get_child(
+	size_t index
+	) const
+{
+	const _node<T> *child = _get_position()->get_child(index);
+
+	return child->get();
+};
+
 template <class T> size_t 
-_tree<T>::get_child_count(void)
+_tree<T>::get_child_count(void) const
 {
 	return _get_position()->get_child_count();
 };
@@ -483,11 +602,12 @@ _tree<T>::get_child_node(
 	size_t index
 	)
 {
-	_node<T> *result = NULL;
+	_node<T> *position = _get_position(), *result = NULL;
 
-	move_child(index);
-	result = get_position_node();
-	move_parent();
+	if(index >= position->get_child_count()) {
+		THROW_TREE_EXC_W_MESS(index, TREE_EXC_INVAL_CHILD_NODE_INDEX);
+	}
+	result = position->get_child(index);
 
 	if(!result) {
 		THROW_TREE_EXC(TREE_EXC_INVAL_CHILD_NODE);
@@ -496,26 +616,63 @@ _tree<T>::get_child_node(
 	return result;
 }
 
+template <class T> const _node<T> *
+_tree<T>::get_child_node(
+	size_t index
+	) const
+{
+	const _node<T> *position = _get_position(), *result = NULL;
+
+	if(index >= position->get_child_count()) {
+		THROW_TREE_EXC_W_MESS(index, TREE_EXC_INVAL_CHILD_NODE_INDEX);
+	}
+	result = position->get_child(index);
+
+	if(!result) {
+		THROW_TREE_EXC(TREE_EXC_INVAL_CHILD_NODE);
+	}
+
+	return result;
+}
+
+template <class T> size_t 
+_tree<T>::get_copy_count(void)
+{
+	return _copy_count.load(std::memory_order_relaxed);
+};
+
 template <class T> T &
 _tree<T>::get_root(void)
 {
 	return _root->get();
 }
 
+template <class T> const T &
+_tree<T>::get_root(void) const
+{
+	return _get_root()->get();
+}
+
 template <class T> _node<T> *
 _tree<T>::get_root_node(void)
 {
 	return _root;
 }
 
+template <class T> const _node<T> *
+_tree<T>::get_root_node(void) const
+{
+	return _root;
+}
+
 template <class T> bool 
-_tree<T>::has_children(void)
+_tree<T>::has_children(void) const
 {
 	return _get_position()->has_children();
 };
 
 template <class T> bool 
-_tree<T>::has_parent(void)
+_tree<T>::has_parent(void) const
 {
 	return _get_position()->has_parent();
 };
@@ -608,20 +765,52 @@ _tree<T>::remove_child(
 		THROW_TREE_EXC_W_MESS(index, TREE_EXC_INVAL_CHILD_NODE_INDEX);
 	}
 	old_child = position->remove_child(index);
+	_clear_helper(&old_child);
+};
+
+template <class T> void 
+_tree<T>::remove_children(void)
+{
+	_node<T> *position = _get_position(), *old_child = NULL;
+	typename _node<T>::child_iterator child;
 
-	if(old_child) {
-		delete old_child;
-		old_child = NULL;
+	for(child = position->get_child_begin(); child != position->get_child_end(); ++child) {
+		old_child = *child;
+		_clear_helper(&old_child);
 	}
+	position->remove_children();
 };
 
 template <class T> void 
-_tree<T>::remove_children(void)
+_tree<T>::splice_child_nodes(
+	const std::vector<_tree<T> *> &others,
+	size_t index
+	)
 {
+	std::vector<_node<T> *> children;
 	_node<T> *position = _get_position();
+	typename std::vector<_tree<T> *>::const_iterator other;
+
+	if(index > position->get_child_count()) {
+		THROW_TREE_EXC_W_MESS(index, TREE_EXC_INVAL_CHILD_NODE_INDEX);
+	}
+
+	for(other = others.begin(); other != others.end(); ++other) {
+
+		if(*other == this) {
+			THROW_TREE_EXC(TREE_EXC_INVAL_CHILD_NODE);
+		}
+		children.push_back((*other)->_get_root());
+	}
+
+	if(!children.empty()) {
+		position->insert_children(&children[0], children.size(), index);
+	}
 
-	while(position->has_children()) {
-		remove_child(0);
+	for(other = others.begin(); other != others.end(); ++other) {
+		(*other)->_root = NULL;
+		(*other)->_position = NULL;
+		(*other)->clear();
 	}
 };
 
@@ -632,7 +821,7 @@ _tree<T>::to_string(
 {
 	std::stringstream ss;
 	std::queue<_node<T> *> que;
-	std::vector<_node<T> *>::iterator child;
+	typename _node<T>::child_iterator child;
 	_node<T> *curr = NULL;
 	
 	if(_root) {
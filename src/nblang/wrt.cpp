@@ -0,0 +1,283 @@
+/*
+ * wrt.cpp
+ * Copyright (C) 2013 David Jolly
+ * ----------------------
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <sstream>
+#include <stdexcept>
+#include "lang.h"
+#include "wrt.h"
+
+//#define WRT_TRACING
+#ifndef WRT_TRACING
+#define TRACE_SUBSYSTEM TRC_SUBSYSTEM_EXECUTOR
+#include "trace.h"
+#else
+#define TRACE_HEADER "wrt"
+#include "trace.h"
+#endif
+
+_wrt::_wrt(void) :
+	_active(false),
+	_sleeping(false),
+	_head(0),
+	_tail(0)
+{
+	TRACE_EVENT("+_wrt::_wrt", TRACE_TYPE_INFORMATION);
+	TRACE_EVENT("-_wrt::_wrt", TRACE_TYPE_INFORMATION);
+}
+
+_wrt::_wrt(
+	const _wrt &other
+	) :
+		_active(false),
+		_sleeping(false),
+		_head(0),
+		_tail(0)
+{
+	TRACE_EVENT("+_wrt::_wrt", TRACE_TYPE_INFORMATION);
+
+	UNREF_PARAM(other);
+
+	TRACE_EVENT("-_wrt::_wrt", TRACE_TYPE_INFORMATION);
+}
+
+_wrt::~_wrt(void)
+{
+	TRACE_EVENT("+_wrt::~_wrt", TRACE_TYPE_INFORMATION);
+
+	stop();
+
+	TRACE_EVENT("-_wrt::~_wrt", TRACE_TYPE_INFORMATION);
+}
+
+_wrt &
+_wrt::operator=(
+	const _wrt &other
+	)
+{
+	TRACE_EVENT("_wrt::operator=", TRACE_TYPE_INFORMATION);
+
+	UNREF_PARAM(other);
+
+	return *this;
+}
+
+wrt_entry_ptr 
+_wrt::_acquire(void)
+{
+	TRACE_EVENT("+_wrt::_acquire", TRACE_TYPE_VERBOSE);
+
+	size_t tail = _tail.load(std::memory_order_relaxed);
+
+	if(!_thread.joinable()) {
+		start();
+	}
+
+	if(tail - _head.load(std::memory_order_acquire) >= WRT_QUEUE_SIZE) {
+		TRACE_EVENT("Writer queue full", TRACE_TYPE_VERBOSE);
+		drain();
+	}
+
+	TRACE_EVENT("-_wrt::_acquire", TRACE_TYPE_VERBOSE);
+
+	return &_queue[tail % WRT_QUEUE_SIZE];
+}
+
+void 
+_wrt::_publish(void)
+{
+	TRACE_EVENT("+_wrt::_publish", TRACE_TYPE_VERBOSE);
+
+	_tail.fetch_add(1);
+
+	if(_sleeping.load()) {
+		std::lock_guard<std::mutex> lock(_lock);
+		_signal.notify_one();
+	}
+
+	TRACE_EVENT("-_wrt::_publish", TRACE_TYPE_VERBOSE);
+}
+
+void 
+_wrt::_run(void)
+{
+	size_t head = _head.load(std::memory_order_relaxed);
+	wrt_entry_ptr entry = NULL;
+
+	for(;;) {
+
+		if(head == _tail.load(std::memory_order_acquire)) {
+			std::unique_lock<std::mutex> lock(_lock);
+
+			_sleeping.store(true);
+			_idle.notify_all();
+
+			while(_active.load()
+					&& head == _tail.load()) {
+				_signal.wait(lock);
+			}
+			_sleeping.store(false);
+
+			if(head == _tail.load()) {
+				break;
+			}
+			continue;
+		}
+		entry = &_queue[head % WRT_QUEUE_SIZE];
+
+		if(!entry->data.empty()) {
+			entry->stream->write(entry->data.c_str(), entry->data.size());
+		}
+
+		if(entry->flush) {
+			entry->stream->flush();
+		}
+		entry->data.clear();
+		_head.store(++head, std::memory_order_release);
+	}
+}
+
+void 
+_wrt::drain(void)
+{
+	TRACE_EVENT("+_wrt::drain", TRACE_TYPE_VERBOSE);
+
+	if(_thread.joinable()) {
+		std::unique_lock<std::mutex> lock(_lock);
+
+		while(_head.load() != _tail.load()) {
+			_idle.wait(lock);
+		}
+	}
+
+	TRACE_EVENT("-_wrt::drain", TRACE_TYPE_VERBOSE);
+}
+
+size_t 
+_wrt::get_pending_count(void)
+{
+	TRACE_EVENT("_wrt::get_pending_count", TRACE_TYPE_VERBOSE);
+
+	return _tail.load() - _head.load();
+}
+
+bool 
+_wrt::is_running(void)
+{
+	TRACE_EVENT("_wrt::is_running", TRACE_TYPE_VERBOSE);
+
+	return _thread.joinable();
+}
+
+void 
+_wrt::push(
+	std::ostream &stream,
+	const char *data,
+	size_t length,
+	bool is_flush
+	)
+{
+	TRACE_EVENT("+_wrt::push", TRACE_TYPE_VERBOSE);
+
+	wrt_entry_ptr entry = _acquire();
+
+	entry->data.assign(data, length);
+	entry->flush = is_flush;
+	entry->stream = &stream;
+	_publish();
+
+	TRACE_EVENT("-_wrt::push", TRACE_TYPE_VERBOSE);
+}
+
+void 
+_wrt::push(
+	std::ostream &stream,
+	std::string &data,
+	bool is_flush
+	)
+{
+	TRACE_EVENT("+_wrt::push", TRACE_TYPE_VERBOSE);
+
+	wrt_entry_ptr entry = _acquire();
+
+	entry->data.swap(data);
+	entry->flush = is_flush;
+	entry->stream = &stream;
+	_publish();
+
+	TRACE_EVENT("-_wrt::push", TRACE_TYPE_VERBOSE);
+}
+
+void 
+_wrt::start(void)
+{
+	TRACE_EVENT("+_wrt::start", TRACE_TYPE_INFORMATION);
+
+	if(!_thread.joinable()) {
+		_active.store(true);
+
+		try {
+			_thread = std::thread(&_wrt::_run, this);
+		} catch(std::runtime_error &exc) {
+			_active.store(false);
+			TRACE_EVENT("Failed to start writer thread: " << exc.what(), TRACE_TYPE_ERROR);
+			THROW_WRT_EXC_W_MESS(exc.what(), WRT_EXC_THREAD_FAILED);
+		}
+	}
+
+	TRACE_EVENT("-_wrt::start", TRACE_TYPE_INFORMATION);
+}
+
+void 
+_wrt::stop(void)
+{
+	TRACE_EVENT("+_wrt::stop", TRACE_TYPE_INFORMATION);
+
+	if(_thread.joinable()) {
+
+		{
+			std::lock_guard<std::mutex> lock(_lock);
+			_active.store(false);
+			_signal.notify_one();
+		}
+		_thread.join();
+	}
+
+	TRACE_EVENT("-_wrt::stop", TRACE_TYPE_INFORMATION);
+}
+
+std::string 
+_wrt::to_string(
+	bool verbose
+	)
+{
+	TRACE_EVENT("+_wrt::to_string", TRACE_TYPE_VERBOSE);
+
+	std::stringstream ss;
+
+	ss << "Writer: " << (is_running() ? "running" : "stopped") << ", Pending: " << get_pending_count() 
+			<< "/" << WRT_QUEUE_SIZE;
+
+	if(verbose) {
+		ss << " (head " << _head.load() << ", tail " << _tail.load() << ")";
+	}
+
+	TRACE_EVENT("-_wrt::to_string", TRACE_TYPE_VERBOSE);
+
+	return ss.str();
+}
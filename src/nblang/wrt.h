@@ -0,0 +1,194 @@
+/*
+ * wrt.h
+ * Copyright (C) 2013 David Jolly
+ * ----------------------
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#ifndef WRT_H_
+#define WRT_H_
+
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <ostream>
+#include <thread>
+#include "wrt_type.h"
+
+/*
+ * Writer queue entry
+ */
+typedef struct _wrt_entry {
+
+	/*
+	 * Entry data
+	 */
+	std::string data;
+
+	/*
+	 * Entry destination stream
+	 */
+	bool flush;
+	std::ostream *stream;
+
+} wrt_entry, *wrt_entry_ptr;
+
+/*
+ * Writer class
+ * (drains output on a background thread, started on first use; entries
+ * are written in queue order, so ordering holds per destination; the
+ * queue has a single producer, which must drain the writer before
+ * touching a destination stream itself)
+ */
+typedef class _wrt {
+
+	public:
+
+		/*
+		 * Writer constructor
+		 */
+		_wrt(void);
+
+		/*
+		 * Writer destructor
+		 */
+		virtual ~_wrt(void);
+
+		/*
+		 * Wait for all queued entries to be written
+		 */
+		void drain(void);
+
+		/*
+		 * Retrieve queued entry count
+		 * @return queued entry count
+		 */
+		size_t get_pending_count(void);
+
+		/*
+		 * Check if writer thread is running
+		 * @return true if running, false otherwise
+		 */
+		bool is_running(void);
+
+		/*
+		 * Queue data for a destination stream
+		 * @param stream destination stream reference
+		 * @param data data pointer
+		 * @param length data length in bytes
+		 * @param is_flush true to flush the stream after writing, false otherwise
+		 */
+		void push(
+			std::ostream &stream,
+			const char *data,
+			size_t length,
+			bool is_flush
+			);
+
+		/*
+		 * Queue data for a destination stream
+		 * (the data is swapped into the queue, leaving an empty string)
+		 * @param stream destination stream reference
+		 * @param data data string reference
+		 * @param is_flush true to flush the stream after writing, false otherwise
+		 */
+		void push(
+			std::ostream &stream,
+			std::string &data,
+			bool is_flush
+			);
+
+		/*
+		 * Start writer thread
+		 */
+		void start(void);
+
+		/*
+		 * Drain queued entries and stop writer thread
+		 */
+		void stop(void);
+
+		/*
+		 * Retrieve string represenation
+		 * @param verbose verbose string status
+		 * @return string represenation
+		 */
+		std::string to_string(
+			bool verbose
+			);
+
+	protected:
+
+		/*
+		 * Writer constructor
+		 * (writers are not copyable)
+		 * @param other writer object reference
+		 */
+		_wrt(
+			const _wrt &other
+			);
+
+		/*
+		 * Writer assignment operator
+		 * (writers are not copyable)
+		 * @param other writer object reference
+		 * @return writer object reference
+		 */
+		_wrt &operator=(
+			const _wrt &other
+			);
+
+		/*
+		 * Reserve the next queue entry, blocking while the queue is full
+		 * @return queue entry pointer
+		 */
+		wrt_entry_ptr _acquire(void);
+
+		/*
+		 * Publish the last reserved queue entry
+		 */
+		void _publish(void);
+
+		/*
+		 * Writer thread routine
+		 */
+		void _run(void);
+
+		/*
+		 * Writer thread state
+		 */
+		std::atomic<bool> _active;
+		std::atomic<bool> _sleeping;
+		std::thread _thread;
+
+		/*
+		 * Writer queue
+		 * (head is advanced by the writer thread, tail by the producer)
+		 */
+		std::atomic<size_t> _head;
+		wrt_entry _queue[WRT_QUEUE_SIZE];
+		std::atomic<size_t> _tail;
+
+		/*
+		 * Writer signals
+		 */
+		std::condition_variable _idle;
+		std::mutex _lock;
+		std::condition_variable _signal;
+
+} wrt, *wrt_ptr;
+
+#endif
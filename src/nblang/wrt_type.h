@@ -0,0 +1,74 @@
+/*
+ * wrt_type.h
+ * Copyright (C) 2013 David Jolly
+ * ----------------------
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#ifndef WRT_TYPE_H_
+#define WRT_TYPE_H_
+
+#include <string>
+
+class _wrt;
+typedef _wrt wrt, *wrt_ptr;
+
+/*
+ * Writer exception types
+ */
+enum {
+	WRT_EXC_THREAD_FAILED = 0,
+};
+
+/*
+ * Max writer types
+ */
+#define MAX_WRT_EXC_TYPE WRT_EXC_THREAD_FAILED
+
+/*
+ * Writer queue length
+ * (a full queue blocks the producer until the writer drains it)
+ */
+#define WRT_QUEUE_SIZE 0x100
+
+/*
+ * Writer strings
+ */
+static const std::string WRT_EXC_STR[] = {
+	"Failed to start writer thread",
+};
+
+/*
+ * Writer string lookup macros
+ */
+#define WRT_EXC_STRING(_T_) (_T_ > MAX_WRT_EXC_TYPE ? "Unknown writer exception type" : WRT_EXC_STR[_T_])
+
+/*
+ * Writer exception macros
+ */
+#define THROW_WRT_EXC(_T_) {\
+	std::stringstream ss;\
+	ss << WRT_EXC_STRING(_T_);\
+	throw std::runtime_error(ss.str().c_str());\
+	}
+	
+#define THROW_WRT_EXC_W_MESS(_M_, _T_) {\
+	std::stringstream ss;\
+	ss << WRT_EXC_STRING(_T_) << ": " << _M_;\
+	throw std::runtime_error(ss.str().c_str());\
+	}
+
+#endif
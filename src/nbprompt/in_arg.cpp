@@ -43,6 +43,7 @@ _in_arg::_in_arg(
 		_arguments(other._arguments),
 		_input(other._input),
 		_is_file(other._is_file),
+		_options(other._options),
 		_signal(other._signal)
 {
 	return;
@@ -62,6 +63,7 @@ _in_arg::operator=(
 		_arguments = other._arguments;
 		_input = other._input;
 		_is_file = other._is_file;
+		_options = other._options;
 		_signal = other._signal;
 	}
 
@@ -90,6 +92,7 @@ _in_arg::clear(void)
 	_arguments.clear();
 	_input.clear();
 	_is_file = false;
+	_options.clear();
 	_signal = PPT_ARG_SIG_EXIT;
 }
 
@@ -102,6 +105,7 @@ _in_arg::clear(
 	_arguments.clear();
 	_input = input;
 	_is_file = is_file;
+	_options.clear();
 	_signal = PPT_ARG_SIG_EXIT;
 }
 
@@ -129,6 +133,16 @@ _in_arg::get_input(void)
 	return _input;
 }
 
+std::string 
+_in_arg::get_option_value(
+	size_t type
+	)
+{
+	std::map<size_t, std::string>::iterator option = _options.find(type);
+
+	return (option != _options.end()) ? option->second : std::string();
+}
+
 size_t 
 _in_arg::get_signal(void)
 {
@@ -141,6 +155,14 @@ _in_arg::has_arguments(void)
 	return !_arguments.empty();
 }
 
+bool 
+_in_arg::has_option(
+	size_t type
+	)
+{
+	return _options.find(type) != _options.end();
+}
+
 void 
 _in_arg::insert_argument(
 	const arg &argument,
@@ -207,6 +229,28 @@ _in_arg::set_input(
 	_input = input;
 }
 
+void 
+_in_arg::set_option(
+	size_t type,
+	bool value
+	)
+{
+	if(value) {
+		_options.insert(std::pair<size_t, std::string>(type, std::string()));
+	} else {
+		_options.erase(type);
+	}
+}
+
+void 
+_in_arg::set_option_value(
+	size_t type,
+	const std::string &value
+	)
+{
+	_options[type] = value;
+}
+
 void 
 _in_arg::set_signal(
 	size_t signal
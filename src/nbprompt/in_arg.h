@@ -20,6 +20,7 @@
 #ifndef IN_ARG_H_
 #define IN_ARG_H_
 
+#include <map>
 #include <string>
 #include <vector>
 #include "arg.h"
@@ -120,6 +121,15 @@ typedef class _in_arg {
 		 */
 		std::string &get_input(void);
 
+		/*
+		 * Retrieve option value
+		 * @param type option argument type
+		 * @return option value string, empty if unset
+		 */
+		std::string get_option_value(
+			size_t type
+			);
+
 		/*
 		 * Retrieve input argument signal
 		 * @return input argument signal
@@ -132,6 +142,15 @@ typedef class _in_arg {
 		 */
 		bool has_arguments(void);
 
+		/*
+		 * Retrieve option status
+		 * @param type option argument type
+		 * @return true if set, false otherwise
+		 */
+		bool has_option(
+			size_t type
+			);
+
 		/*
 		 * Insert an argument after a given index
 		 * @param argument argument reference
@@ -187,6 +206,26 @@ typedef class _in_arg {
 			const std::string &input
 			);
 
+		/*
+		 * Set option status
+		 * @param type option argument type
+		 * @param value true to set, false otherwise
+		 */
+		void set_option(
+			size_t type,
+			bool value
+			);
+
+		/*
+		 * Set option with a given value
+		 * @param type option argument type
+		 * @param value option value string reference
+		 */
+		void set_option_value(
+			size_t type,
+			const std::string &value
+			);
+
 		/*
 		 * Set input signal
 		 * @param signal input signal
@@ -221,6 +260,11 @@ typedef class _in_arg {
 		 */
 		bool _is_file;
 
+		/*
+		 * Option argument types and values
+		 */
+		std::map<size_t, std::string> _options;
+
 		/*
 		 * Input signal
 		 */
@@ -19,6 +19,7 @@
 
 #include <ctime>
 #include <iostream>
+#include <new>
 #include <stdexcept>
 #include <vector>
 #include "arg_type.h"
@@ -26,6 +27,35 @@
 #include "ppt_type.h"
 #include "ppt_ext.h"
 #include "ppt_ext_type.h"
+#include "..\nblang\hpf.h"
+#include "..\nblang\trc.h"
+
+#ifdef HEAP_PROFILING
+/*
+ * Allocate memory, attributed to the calling thread's heap profile owner
+ * @param size allocation size in bytes
+ * @return pointer to allocated memory
+ */
+void *
+operator new(
+	size_t size
+	)
+{
+	return hpf::allocate(size);
+}
+
+/*
+ * Free memory
+ * @param ptr pointer to allocated memory
+ */
+void 
+operator delete(
+	void *ptr
+	) throw()
+{
+	hpf::release(ptr);
+}
+#endif
 
 /*
  * Register prompt command
@@ -106,6 +136,8 @@ main(
 		register_command(prompt, cmd_schema[PPT_CMD_LICENSE], PPT_CMD_STRING(PPT_CMD_LICENSE), ppt_ext_hdl_lic_command, false);
 		register_command(prompt, cmd_schema[PPT_CMD_LOAD], PPT_CMD_STRING(PPT_CMD_LOAD), load_arguments, ppt_ext_hdl_load_command, true);
 		register_command(prompt, cmd_schema[PPT_CMD_RESET], PPT_CMD_STRING(PPT_CMD_RESET), ppt_ext_hdl_res_command, false);
+		register_command(prompt, cmd_schema[PPT_CMD_STATS], PPT_CMD_STRING(PPT_CMD_STATS), ppt_ext_hdl_stats_command, false);
+		register_command(prompt, cmd_schema[PPT_CMD_TRACE], PPT_CMD_STRING(PPT_CMD_TRACE), ppt_ext_hdl_trace_command, false);
 		register_command(prompt, cmd_schema[PPT_CMD_VERSION], PPT_CMD_STRING(PPT_CMD_VERSION), ppt_ext_hdl_ver_command, false);
 		prompt.set_argument_action(ppt_ext_hdl_arguments);
 		prompt.set_exception_action(ppt_ext_hdl_exceptions);
@@ -116,5 +148,13 @@ main(
 		result = 1;
 	}
 
+	if(trc::is_active()) {
+		std::cerr << trc::to_string() << std::endl << std::endl;
+	}
+
+	if(hpf::is_active()) {
+		std::cerr << hpf::to_string() << std::endl << std::endl;
+	}
+
 	return result;
 }
\ No newline at end of file
@@ -18,6 +18,7 @@
  */
 
 #include <csignal>
+#include <fstream>
 #include <iomanip>
 #include <iostream>
 #include <sstream>
@@ -27,7 +28,8 @@
 
 //#define PROMPT_TRACING
 #ifndef PROMPT_TRACING
-#define TRACE_EVENT(_M_, _T_)
+#define TRACE_SUBSYSTEM TRC_SUBSYSTEM_PROMPT
+#include "..\nblang\trace.h"
 #else
 #define TRACE_HEADER "prompt"
 #include "..\nblang\trace.h"
@@ -49,6 +51,7 @@ _ppt::_ppt(
 		_argument_action(other._argument_action),
 		_generic_action(other._generic_action),
 		_exception_action(other._exception_action),
+		_executor(other._executor),
 		_schema(other._schema)
 {
 	TRACE_EVENT("+_ppt::_ppt", TRACE_TYPE_INFORMATION);
@@ -73,6 +76,7 @@ _ppt::operator=(
 		_argument_action = other._argument_action;
 		_generic_action = other._generic_action;
 		_exception_action = other._exception_action;
+		_executor = other._executor;
 		_schema = other._schema;
 	}
 
@@ -121,30 +125,39 @@ _ppt::_invoke_executor(
 	in_arg &arguments
 	)
 {
-	size_t i = 0;
+	TRACE_EVENT("+_ppt::_invoke_executor", TRACE_TYPE_VERBOSE);
+
 	tok_vector tok_args;
+	size_t i = 0, signal;
+
+	if(!_executor) {
+		THROW_PPT_EXC(PPT_EXC_MISSING_EXECUTOR);
+	}
 
 	for(; i < arguments.get_argument_count(); ++i) {
 		tok_args.push_back(arguments.get_argument(i).to_token());
 	}
-	_invoke_executor(arguments.get_input(), tok_args, arguments.is_file());
-}
 
-void
-_ppt::_invoke_executor(
-	const std::string &input,
-	const tok_vector &arguments,
-	bool is_file
-	)
-{
-	TRACE_EVENT("+_ppt::_invoke_executor", TRACE_TYPE_VERBOSE);
+	_executor->initialize(arguments.get_input(), tok_args, arguments.is_file(), true);
 
-	exe exec;
+	try {
+		signal = _executor->evaluate();
+	} catch(std::runtime_error &exc) {
+		UNREF_PARAM(exc);
 
-	exec.set_action(exe_config_parser, EXE_ACTION_CONFIG_PARSER);
-	exec.set_evaluation_action(exe_eval_statement, EXE_EVAL_ACTION_STATEMENT);
-	exec.initialize(input, arguments, is_file, true);
-	exec.evaluate();
+		try {
+			report_executor(*_executor, arguments.get_option_value(PPT_ARG_PROFILE_FOLDED), arguments.get_option_value(PPT_ARG_STATISTICS));
+		} catch(std::runtime_error &report_exc) {
+			std::cerr << "Exception: " << report_exc.what() << std::endl << std::endl;
+		}
+		throw;
+	}
+	report_executor(*_executor, arguments.get_option_value(PPT_ARG_PROFILE_FOLDED), arguments.get_option_value(PPT_ARG_STATISTICS));
+
+	if(signal == EXE_SIG_ABORT) {
+		std::cerr << _executor->get_budget().to_string() << std::endl << std::endl;
+		THROW_PPT_EXC_W_MESS(BUD_LIMIT_STRING(_executor->get_budget().get_exhausted()) << " budget exhausted", PPT_EXC_EXECUTION_ABORTED);
+	}
 
 	TRACE_EVENT("-_ppt::_invoke_executor", TRACE_TYPE_VERBOSE);
 }
@@ -283,6 +296,7 @@ _ppt::clear(void)
 	_active = false;
 	_argument_action = NULL;
 	_exception_action = NULL;
+	_executor = NULL;
 	_generic_action = NULL;
 	_schema.clear();
 
@@ -380,6 +394,91 @@ _ppt::register_schema(
 	TRACE_EVENT("-_ppt::register_schema", TRACE_TYPE_INFORMATION);
 }
 
+void 
+_ppt::report_executor(
+	exe &executor,
+	const std::string &folded_path,
+	const std::string &statistics_path
+	)
+{
+	TRACE_EVENT("+_ppt::report_executor", TRACE_TYPE_INFORMATION);
+
+	if(executor.get_profiler().is_enabled()) {
+		report_profile(executor.get_profiler(), folded_path);
+	}
+
+	if(executor.get_memory().is_enabled()) {
+		executor.sample_memory();
+		report_memory(executor.get_memory());
+	}
+
+	if(executor.get_statistics().is_enabled()) {
+		report_statistics(executor.get_statistics(), statistics_path);
+	}
+
+	TRACE_EVENT("-_ppt::report_executor", TRACE_TYPE_INFORMATION);
+}
+
+void 
+_ppt::report_memory(
+	mem &memory
+	)
+{
+	TRACE_EVENT("+_ppt::report_memory", TRACE_TYPE_INFORMATION);
+
+	std::cerr << memory.to_string() << std::endl << std::endl;
+
+	TRACE_EVENT("-_ppt::report_memory", TRACE_TYPE_INFORMATION);
+}
+
+void 
+_ppt::report_profile(
+	prf &profiler,
+	const std::string &folded_path
+	)
+{
+	TRACE_EVENT("+_ppt::report_profile", TRACE_TYPE_INFORMATION);
+
+	std::ofstream file;
+
+	std::cerr << profiler.to_string(false) << std::endl << std::endl;
+
+	if(!folded_path.empty()) {
+		file.open(folded_path.c_str(), std::ios::out | std::ios::trunc);
+
+		if(!file) {
+			THROW_PPT_EXC_W_MESS(folded_path, PPT_EXC_PROFILE_WRITE_FAILED);
+		}
+		file << profiler.to_folded_string();
+		file.close();
+	}
+
+	TRACE_EVENT("-_ppt::report_profile", TRACE_TYPE_INFORMATION);
+}
+
+void 
+_ppt::report_statistics(
+	sta &statistics,
+	const std::string &path
+	)
+{
+	TRACE_EVENT("+_ppt::report_statistics", TRACE_TYPE_INFORMATION);
+
+	std::ofstream file;
+
+	if(!path.empty()) {
+		file.open(path.c_str(), std::ios::out | std::ios::trunc);
+
+		if(!file) {
+			THROW_PPT_EXC_W_MESS(path, PPT_EXC_STATISTICS_WRITE_FAILED);
+		}
+		file << statistics.to_json() << std::endl;
+		file.close();
+	}
+
+	TRACE_EVENT("-_ppt::report_statistics", TRACE_TYPE_INFORMATION);
+}
+
 void 
 _ppt::set_argument_action(
 	ppt_arg_action argument_action
@@ -404,6 +503,18 @@ _ppt::set_exception_action(
 	TRACE_EVENT("-_ppt::set_exception_action", TRACE_TYPE_VERBOSE);
 }
 
+void 
+_ppt::set_executor(
+	exe &executor
+	)
+{
+	TRACE_EVENT("+_ppt::set_executor", TRACE_TYPE_VERBOSE);
+
+	_executor = &executor;
+
+	TRACE_EVENT("-_ppt::set_executor", TRACE_TYPE_VERBOSE);
+}
+
 void 
 _ppt::set_generic_action(
 	ppt_action generic_action
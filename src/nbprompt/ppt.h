@@ -107,6 +107,46 @@ typedef class _ppt {
 			sch &schema
 			);
 
+		/*
+		 * Write every enabled executor report
+		 * @param executor executor object reference
+		 * @param folded_path folded call stack file path, empty to skip
+		 * @param statistics_path statistics file path, empty to skip
+		 */
+		void report_executor(
+			exe &executor,
+			const std::string &folded_path,
+			const std::string &statistics_path
+			);
+
+		/*
+		 * Write memory accounting report to stderr
+		 * @param memory memory accounting object reference
+		 */
+		void report_memory(
+			mem &memory
+			);
+
+		/*
+		 * Write profiler report to stderr, and folded call stacks to a file
+		 * @param profiler profiler object reference
+		 * @param folded_path folded call stack file path, empty to skip
+		 */
+		void report_profile(
+			prf &profiler,
+			const std::string &folded_path
+			);
+
+		/*
+		 * Write execution statistics as JSON to a file
+		 * @param statistics statistics object reference
+		 * @param path statistics file path, empty to skip
+		 */
+		void report_statistics(
+			sta &statistics,
+			const std::string &path
+			);
+
 		/*
 		 * Assign argument action
 		 * @param ppt_arg_action argument action
@@ -123,6 +163,14 @@ typedef class _ppt {
 			ppt_exc_action exception_action
 			);
 
+		/*
+		 * Assign executor used for command line input
+		 * @param executor executor object reference
+		 */
+		void set_executor(
+			exe &executor
+			);
+
 		/*
 		 * Assign generic action
 		 * @param generic_action generic action
@@ -195,17 +243,6 @@ typedef class _ppt {
 			in_arg &arguments
 			);
 
-		/*
-		 * Invoke executor instance
-		 * @param input command input reference
-		 * @param arguments argument list reference
-		 */
-		void _invoke_executor(
-			const std::string &input,
-			const tok_vector &arguments,
-			bool is_file
-			);
-
 		/*
 		 * Invoke prompt instance
 		 * @param arguments argument list reference
@@ -236,6 +273,11 @@ typedef class _ppt {
 		ppt_exc_action _exception_action;
 		ppt_action _generic_action;
 
+		/*
+		 * Prompt executor
+		 */
+		exe_ptr _executor;
+
 		/*
 		 * Prompt registered command schema list
 		 */
@@ -17,6 +17,8 @@
  * along with this program.  If not, see <http://www.gnu.org/licenses/>.
  */
 
+#include <climits>
+#include <cstdlib>
 #include <iostream>
 #include <sstream>
 #include <stdexcept>
@@ -27,10 +29,12 @@
 #include "ppt_ext.h"
 #include "ppt_ext_type.h"
 #include "..\nblang\par_ext.h"
+#include "..\nblang\trc.h"
 
 //#define PROMPT_EXT_TRACING
 #ifndef PROMPT_EXT_TRACING
-#define TRACE_EVENT(_M_, _T_)
+#define TRACE_SUBSYSTEM TRC_SUBSYSTEM_PROMPT
+#include "..\nblang\trace.h"
 #else
 #define TRACE_HEADER "prompt_ext"
 #include "..\nblang\trace.h"
@@ -40,6 +44,8 @@
  * Prompt extension executor instance
  */
 static exe ppt_exe;
+static std::string ppt_exe_folded_path;
+static std::string ppt_exe_statistics_path;
 
 in_arg 
 ppt_ext_hdl_arguments(
@@ -51,6 +57,8 @@ ppt_ext_hdl_arguments(
 
 	size_t type;
 	in_arg result;
+	unsigned long long limit;
+	char *limit_end = NULL;
 	std::string output, input;
 	bool done = false, flag[MAX_PPT_ARG_TYPE + 1];
 	std::vector<std::string>::const_iterator arg_iter = arguments.begin();
@@ -75,6 +83,35 @@ ppt_ext_hdl_arguments(
 				type = ppt_find_argument(input);
 
 				switch(type) {
+					case PPT_ARG_ASYNC_OUT:
+						ppt_exe.get_stream().set_async(true);
+						result.set_option(type, true);
+						break;
+					case PPT_ARG_BUDGET_EXPRESSIONS:
+					case PPT_ARG_BUDGET_STATEMENTS:
+					case PPT_ARG_DEADLINE:
+						++arg_iter;
+
+						if(arg_iter == arguments.end()) {
+							THROW_PPT_EXT_EXC_W_MESS(ARG_FLAG_0 << PPT_ARG_STRING_0(type) << " (" << ARG_FLAG_1 << PPT_ARG_STRING_1(type) << ")", PPT_EXT_EXC_MISSING_INPUT);
+						}
+						limit = strtoull(arg_iter->c_str(), &limit_end, 0);
+
+						if(!limit
+								|| *limit_end
+								|| ((type == PPT_ARG_DEADLINE) && (limit > (ULLONG_MAX / PPT_DEADLINE_SCALE)))) {
+							THROW_PPT_EXT_EXC_W_MESS(*arg_iter, PPT_EXT_EXC_INVAL_ARG);
+						}
+
+						if(type == PPT_ARG_BUDGET_EXPRESSIONS) {
+							ppt_exe.get_budget().set_limit(BUD_LIMIT_EXPRESSION, limit);
+						} else if(type == PPT_ARG_BUDGET_STATEMENTS) {
+							ppt_exe.get_budget().set_limit(BUD_LIMIT_STATEMENT, limit);
+						} else {
+							ppt_exe.get_budget().set_limit(BUD_LIMIT_DEADLINE, limit * PPT_DEADLINE_SCALE);
+						}
+						result.set_option_value(type, *arg_iter);
+						break;
 					case PPT_ARG_FILE_IN:
 					case PPT_ARG_IN:
 						++arg_iter;
@@ -108,6 +145,60 @@ ppt_ext_hdl_arguments(
 						result.set_signal(PPT_ARG_SIG_INTERACT);
 						done = true;
 						break;
+					case PPT_ARG_MEMORY:
+						ppt_exe.get_memory().set_enabled(true);
+						result.set_option(type, true);
+						break;
+					case PPT_ARG_MEMORY_LIMIT:
+						++arg_iter;
+
+						if(arg_iter == arguments.end()) {
+							THROW_PPT_EXT_EXC_W_MESS(ARG_FLAG_0 << PPT_ARG_STRING_0(type) << " (" << ARG_FLAG_1 << PPT_ARG_STRING_1(type) << ")", PPT_EXT_EXC_MISSING_INPUT);
+						}
+						limit = strtoull(arg_iter->c_str(), &limit_end, 0);
+
+						if(!limit
+								|| *limit_end
+								|| (limit > (size_t) -1)) {
+							THROW_PPT_EXT_EXC_W_MESS(*arg_iter, PPT_EXT_EXC_INVAL_ARG);
+						}
+						ppt_exe.get_memory().set_limit((size_t) limit);
+						result.set_option_value(type, *arg_iter);
+						break;
+					case PPT_ARG_PROFILE:
+						ppt_exe.get_profiler().set_enabled(true);
+						result.set_option(type, true);
+						break;
+					case PPT_ARG_PROFILE_FOLDED:
+						++arg_iter;
+
+						if(arg_iter == arguments.end()) {
+							THROW_PPT_EXT_EXC_W_MESS(ARG_FLAG_0 << PPT_ARG_STRING_0(type) << " (" << ARG_FLAG_1 << PPT_ARG_STRING_1(type) << ")", PPT_EXT_EXC_MISSING_INPUT);
+						}
+						ppt_exe_folded_path = *arg_iter;
+						ppt_exe.get_profiler().set_enabled(true);
+						result.set_option_value(type, ppt_exe_folded_path);
+						break;
+					case PPT_ARG_STATISTICS:
+						++arg_iter;
+
+						if(arg_iter == arguments.end()) {
+							THROW_PPT_EXT_EXC_W_MESS(ARG_FLAG_0 << PPT_ARG_STRING_0(type) << " (" << ARG_FLAG_1 << PPT_ARG_STRING_1(type) << ")", PPT_EXT_EXC_MISSING_INPUT);
+						}
+						ppt_exe_statistics_path = *arg_iter;
+						ppt_exe.get_statistics().set_enabled(true);
+						result.set_option_value(type, ppt_exe_statistics_path);
+						break;
+					case PPT_ARG_TRACE:
+						++arg_iter;
+
+						if(arg_iter == arguments.end()) {
+							THROW_PPT_EXT_EXC_W_MESS(ARG_FLAG_0 << PPT_ARG_STRING_0(type) << " (" << ARG_FLAG_1 << PPT_ARG_STRING_1(type) << ")", PPT_EXT_EXC_MISSING_INPUT);
+						}
+						trc::configure(*arg_iter);
+						trc::install_crash_handler();
+						result.set_option_value(type, *arg_iter);
+						break;
 					case PPT_ARG_VERSION:
 						PROMPT_VERSION(output);
 						std::cout << output << std::endl;
@@ -122,6 +213,10 @@ ppt_ext_hdl_arguments(
 				}
 			}
 		}
+
+		if(result.get_signal() == PPT_ARG_SIG_INTERACT) {
+			ppt_exe.get_statistics().set_enabled(true);
+		}
 	} else {
 		TRACE_EVENT("Invalid prompt parameter!", TRACE_TYPE_ERROR);
 		THROW_PPT_EXT_EXC(PPT_EXT_EXC_INVAL_PARAM);
@@ -186,6 +281,7 @@ ppt_ext_hdl_exit_command(
 	UNREF_PARAM(arguments);
 
 	if(prompt) {
+		prompt->report_executor(ppt_exe, ppt_exe_folded_path, ppt_exe_statistics_path);
 		prompt->stop();
 	} else {
 		TRACE_EVENT("Invalid prompt parameter!", TRACE_TYPE_ERROR);
@@ -205,7 +301,10 @@ ppt_ext_hdl_gen_command(
 
 	if(prompt) {
 		ppt_exe.initialize(arguments.front().get_text(), false, false);
-		ppt_exe.evaluate();
+		
+		if(ppt_exe.evaluate() == EXE_SIG_ABORT) {
+			THROW_PPT_EXC_W_MESS(BUD_LIMIT_STRING(ppt_exe.get_budget().get_exhausted()) << " budget exhausted", PPT_EXC_EXECUTION_ABORTED);
+		}
 	} else {
 		TRACE_EVENT("Invalid prompt parameter!", TRACE_TYPE_ERROR);
 		THROW_PPT_EXT_EXC(PPT_EXT_EXC_INVAL_PARAM);
@@ -282,7 +381,10 @@ ppt_ext_hdl_load_command(
 			tok_vec.push_back(token);
 		}
 		ppt_exe.initialize(path, tok_vec, true, false);
-		ppt_exe.evaluate();
+		
+		if(ppt_exe.evaluate() == EXE_SIG_ABORT) {
+			THROW_PPT_EXC_W_MESS(BUD_LIMIT_STRING(ppt_exe.get_budget().get_exhausted()) << " budget exhausted", PPT_EXC_EXECUTION_ABORTED);
+		}
 	} else {
 		TRACE_EVENT("Invalid prompt parameter!", TRACE_TYPE_ERROR);
 		THROW_PPT_EXT_EXC(PPT_EXT_EXC_INVAL_PARAM);
@@ -311,6 +413,52 @@ ppt_ext_hdl_res_command(
 	TRACE_EVENT("-ppt_ext_hdl_res_command", TRACE_TYPE_INFORMATION);
 }
 
+void 
+ppt_ext_hdl_stats_command(
+	ppt_ptr prompt,
+	std::vector<arg> &arguments
+	)
+{
+	TRACE_EVENT("+ppt_ext_hdl_stats_command", TRACE_TYPE_INFORMATION);
+
+	UNREF_PARAM(arguments);
+
+	if(prompt) {
+		std::cout << ppt_exe.get_statistics().to_string(true) << std::endl << std::endl;
+
+		if(ppt_exe.get_memory().is_enabled()) {
+			ppt_exe.sample_memory();
+			std::cout << ppt_exe.get_memory().to_string() << std::endl << std::endl;
+		}
+	} else {
+		TRACE_EVENT("Invalid prompt parameter!", TRACE_TYPE_ERROR);
+		THROW_PPT_EXT_EXC(PPT_EXT_EXC_INVAL_PARAM);
+	}
+
+	TRACE_EVENT("-ppt_ext_hdl_stats_command", TRACE_TYPE_INFORMATION);
+}
+
+void 
+ppt_ext_hdl_trace_command(
+	ppt_ptr prompt,
+	std::vector<arg> &arguments
+	)
+{
+	TRACE_EVENT("+ppt_ext_hdl_trace_command", TRACE_TYPE_INFORMATION);
+
+	UNREF_PARAM(arguments);
+
+	if(prompt) {
+		std::cerr << trc::to_string() << std::endl << std::endl;
+		trc::clear();
+	} else {
+		TRACE_EVENT("Invalid prompt parameter!", TRACE_TYPE_ERROR);
+		THROW_PPT_EXT_EXC(PPT_EXT_EXC_INVAL_PARAM);
+	}
+
+	TRACE_EVENT("-ppt_ext_hdl_trace_command", TRACE_TYPE_INFORMATION);
+}
+
 void 
 ppt_ext_hdl_ver_command(
 	ppt_ptr prompt,
@@ -345,6 +493,7 @@ ppt_ext_init_exe(
 		ppt_exe.set_action(exe_config_parser, EXE_ACTION_CONFIG_PARSER);
 		ppt_exe.set_evaluation_action(exe_eval_statement, EXE_EVAL_ACTION_STATEMENT);
 		ppt_exe.initialize(std::string(), tok_vector(), false, true);
+		prompt->set_executor(ppt_exe);
 	} else {
 		TRACE_EVENT("Invalid prompt parameter!", TRACE_TYPE_ERROR);
 		THROW_PPT_EXT_EXC(PPT_EXT_EXC_INVAL_PARAM);
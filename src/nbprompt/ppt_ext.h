@@ -73,6 +73,16 @@ extern void ppt_ext_hdl_res_command(
 	std::vector<arg> &arguments
 	);
 
+extern void ppt_ext_hdl_stats_command(
+	ppt_ptr prompt,
+	std::vector<arg> &arguments
+	);
+
+extern void ppt_ext_hdl_trace_command(
+	ppt_ptr prompt,
+	std::vector<arg> &arguments
+	);
+
 extern void ppt_ext_hdl_ver_command(
 	ppt_ptr prompt,
 	std::vector<arg> &arguments
@@ -39,20 +39,34 @@ typedef _ppt ppt, *ppt_ptr;
  */
 enum {
 	PPT_EXC_DUP_SCHEMA_REG = 0,
+	PPT_EXC_EXECUTION_ABORTED,
 	PPT_EXC_INPUT_PIPE_CLOSED,
 	PPT_EXC_INVAL_HDL_ACTION_TYPE,
 	PPT_EXC_INVAL_SCHEMA_CMD,
 	PPT_EXC_INVAL_SCHEMA_UNREG,
 	PPT_EXC_INVAL_SIGNAL_TYPE,
 	PPT_EXC_INVAL_STATE_CHANGE,
+	PPT_EXC_MISSING_EXECUTOR,
+	PPT_EXC_PROFILE_WRITE_FAILED,
+	PPT_EXC_STATISTICS_WRITE_FAILED,
 	PPT_EXC_UNK_SCHEMA_CMD_TYPE,
 };
 
 enum {
-	PPT_ARG_FILE_IN = 0,
+	PPT_ARG_ASYNC_OUT = 0,
+	PPT_ARG_BUDGET_EXPRESSIONS,
+	PPT_ARG_BUDGET_STATEMENTS,
+	PPT_ARG_DEADLINE,
+	PPT_ARG_FILE_IN,
 	PPT_ARG_HELP,
 	PPT_ARG_IN,
 	PPT_ARG_INTERACT,
+	PPT_ARG_MEMORY,
+	PPT_ARG_MEMORY_LIMIT,
+	PPT_ARG_PROFILE,
+	PPT_ARG_PROFILE_FOLDED,
+	PPT_ARG_STATISTICS,
+	PPT_ARG_TRACE,
 	PPT_ARG_VERSION,
 };
 
@@ -69,6 +83,8 @@ enum {
 	PPT_CMD_LICENSE,
 	PPT_CMD_LOAD,
 	PPT_CMD_RESET,
+	PPT_CMD_STATS,
+	PPT_CMD_TRACE,
 	PPT_CMD_VERSION,
 };
 
@@ -91,33 +107,47 @@ enum {
  */
 static const std::string PPT_EXC_STR[] = {
 	"Duplicate schema registration",
+	"Execution aborted",
 	"Input pipe was closed",
 	"Invalid prompt action type",
 	"Attempting to register schema with in valid command",
 	"Attempting to unregister unknown schema",
 	"Invalid argument handler signal type",
 	"Attempting to transition to invalid state",
+	"No executor assigned to prompt",
+	"Failed to write profile",
+	"Failed to write statistics",
 	"Unknown command",
 };
 
 static const std::string PPT_ARG_STR_0[] = {
-	"fi", "h", "in", "i", "v",
+	"ao", "be", "bs", "d", "fi", "h", "in", "i", "m", "ml", "p", "pf", "s", "t", "v",
 };
 
 static const std::string PPT_ARG_STR_1[] = {
-	"file-input", "help", "input", "interactive", "version",
+	"async-output", "budget-expressions", "budget-statements", "deadline", "file-input", "help", "input", "interactive", "memory", "memory-limit", "profile", "profile-folded", "statistics", "trace", "version",
 };
 
 static const std::string PPT_ARG_DESC_STR[] = {
+	"Write output on a background thread (precedes other arguments)",
+	"Abort execution after a number of evaluated expressions, followed by a count (precedes other arguments)",
+	"Abort execution after a number of evaluated statements, followed by a count (precedes other arguments)",
+	"Abort execution after a wall-clock deadline, followed by a time in milliseconds (precedes other arguments)",
 	"Specify an input file to execute, followed by a series of arguments",
 	"Display help information",
 	"Specify input code, followed by a series of arguments",
 	"Enter interactive mode",
+	"Account executor memory and display a current/peak report on exit (precedes other arguments)",
+	"Abort execution once executor memory exceeds a limit, followed by a byte count (precedes other arguments)",
+	"Profile statements and display a hotspot report on exit (precedes other arguments)",
+	"Profile and write folded function call stacks to a file on exit, followed by a path (precedes other arguments)",
+	"Write execution statistics as JSON to a file on exit, followed by a path (precedes other arguments)",
+	"Record trace events and display them on exit, followed by a list of subsystem:level pairs (precedes other arguments)",
 	"Display version information",
 };
 
 static const std::string PPT_CMD_STR[] = {
-	"copyright", "exit", "help", "license", "load", "reset", "version",
+	"copyright", "exit", "help", "license", "load", "reset", "stats", "trace", "version",
 };
 
 static const std::string PPT_CMD_DESC_STR[] = {
@@ -127,6 +157,8 @@ static const std::string PPT_CMD_DESC_STR[] = {
 	"Display license information",
 	"Load a file in interactive mode, followed by a series of arguments",
 	"Reset the state of the interactive mode",
+	"Display execution statistics",
+	"Display and clear recorded trace events",
 	"Display version information",
 };
 
@@ -228,10 +260,15 @@ static const std::set<std::string> PPT_CMD_SET(
 #define PROMPT_USAGE(_S_) {\
 	std::stringstream ss;\
 	ss << "Usage: " << LANG_TITLE << " [" << ARG_FLAG_0 << PPT_ARG_STRING_0(PPT_ARG_HELP) << " | " << ARG_FLAG_0 << PPT_ARG_STRING_0(PPT_ARG_INTERACT) << " | " << ARG_FLAG_0 << PPT_ARG_STRING_0(PPT_ARG_VERSION)\
-		<< "] (" << ARG_FLAG_0 << PPT_ARG_STRING_0(PPT_ARG_FILE_IN) << " [file] args... | " << ARG_FLAG_0 << PPT_ARG_STRING_0(PPT_ARG_IN) << " [input] args...)";\
+		<< "] [" << ARG_FLAG_0 << PPT_ARG_STRING_0(PPT_ARG_ASYNC_OUT) << "] [" << ARG_FLAG_0 << PPT_ARG_STRING_0(PPT_ARG_BUDGET_EXPRESSIONS) << " [count]] [" << ARG_FLAG_0 << PPT_ARG_STRING_0(PPT_ARG_BUDGET_STATEMENTS) << " [count]] [" << ARG_FLAG_0 << PPT_ARG_STRING_0(PPT_ARG_DEADLINE) << " [ms]] [" << ARG_FLAG_0 << PPT_ARG_STRING_0(PPT_ARG_MEMORY) << "] [" << ARG_FLAG_0 << PPT_ARG_STRING_0(PPT_ARG_MEMORY_LIMIT) << " [bytes]] [" << ARG_FLAG_0 << PPT_ARG_STRING_0(PPT_ARG_PROFILE) << "] [" << ARG_FLAG_0 << PPT_ARG_STRING_0(PPT_ARG_PROFILE_FOLDED) << " [file]] [" << ARG_FLAG_0 << PPT_ARG_STRING_0(PPT_ARG_STATISTICS) << " [file]] [" << ARG_FLAG_0 << PPT_ARG_STRING_0(PPT_ARG_TRACE) << " [list]] (" << ARG_FLAG_0 << PPT_ARG_STRING_0(PPT_ARG_FILE_IN) << " [file] args... | " << ARG_FLAG_0 << PPT_ARG_STRING_0(PPT_ARG_IN) << " [input] args...)";\
 	_S_ = ss.str();\
 	}
 
+/*
+ * Prompt deadline argument scale, in nanoseconds per millisecond
+ */
+#define PPT_DEADLINE_SCALE 1000000ULL
+
 /*
  * Prompt exception macros
  */
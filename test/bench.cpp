@@ -0,0 +1,467 @@
+/*
+ * bench.cpp
+ * Copyright (C) 2013 David Jolly
+ * ----------------------
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <algorithm>
+#include <cctype>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <map>
+#include <sstream>
+#include <stdexcept>
+#include <vector>
+#include "bench.h"
+#include "..\src\nblang\clk.h"
+#include "..\src\nblang\exe.h"
+#include "..\src\nblang\exe_ext.h"
+#include "..\src\nblang\lex.h"
+#include "..\src\nblang\lex_ext.h"
+#include "..\src\nblang\par.h"
+#include "..\src\nblang\par_ext.h"
+
+#ifdef _WIN32
+#define WIN32_LEAN_AND_MEAN
+#include <Windows.h>
+#endif
+
+/*
+ * Benchmark allocation count
+ */
+static unsigned long long bench_allocations = 0;
+
+void 
+bench_add_allocation(void)
+{
+	++bench_allocations;
+}
+
+/*
+ * Read benchmark test input
+ * @param test benchmark test type
+ * @param input input string reference
+ * @return true on success, false otherwise
+ */
+bool 
+bench_read_input(
+	size_t test,
+	std::string &input
+	)
+{
+	std::stringstream ss;
+	std::ifstream file(BENCH_TEST_PATH_STRING(test).c_str(), std::ios::in | std::ios::binary);
+
+	if(!file) {
+		return false;
+	}
+	ss << file.rdbuf();
+	input = ss.str();
+
+	return true;
+}
+
+/*
+ * Run a single benchmark stage
+ * @param stage benchmark stage type
+ * @param input input string reference
+ * @param arguments executor argument list reference
+ * @return processed unit count
+ */
+size_t 
+bench_run_stage(
+	size_t stage,
+	const std::string &input,
+	const tok_vector &arguments
+	)
+{
+	lex lx;
+	par pr;
+	exe exec;
+	size_t result = 0;
+
+	switch(stage) {
+		case BENCH_STAGE_LEXER:
+			lx.set_action(lex_skip_whitespace, LEX_ACTION_SKIP_WHITESPACE);
+			lx.set_enumeration_action(lex_enum_alpha, LEX_ENUM_ACTION_ALPHA);
+			lx.set_enumeration_action(lex_enum_number, LEX_ENUM_ACTION_NUMBER);
+			lx.set_enumeration_action(lex_enum_symbol, LEX_ENUM_ACTION_SYMBOL);
+			lx.initialize(input, false);
+			lx.enumerate();
+			result = lx.get_count();
+			break;
+		case BENCH_STAGE_PARSER:
+			pr.set_action(par_config_lexer, PAR_ACTION_CONFIG_LEXER);
+			pr.set_enumeration_action(par_enum_statement, PAR_ENUM_ACTION_STATEMENT);
+			pr.initialize(input, false);
+			pr.enumerate();
+			result = pr.get_count();
+			break;
+		case BENCH_STAGE_EXECUTOR:
+			exec.set_action(exe_config_parser, EXE_ACTION_CONFIG_PARSER);
+			exec.set_evaluation_action(exe_eval_statement, EXE_EVAL_ACTION_STATEMENT);
+			exec.get_statistics().set_enabled(true);
+			exec.initialize(input, arguments, false, true);
+			exec.evaluate();
+			exec.get_stream().flush_stdout();
+			result = (size_t) exec.get_statistics().get(STA_COUNTER_STATEMENT);
+			break;
+		default:
+			throw std::runtime_error("Unknown benchmark stage");
+	}
+
+	return result;
+}
+
+/*
+ * Retrieve a scaling curve name
+ * @param param scaled generator parameter type
+ * @return scaling curve name string
+ */
+std::string 
+bench_scale_name(
+	size_t param
+	)
+{
+	size_t i = 0;
+	std::string result = GEN_PARAM_STRING(param);
+
+	for(; i < result.size(); ++i) {
+		result.at(i) = (char) std::toupper(result.at(i));
+	}
+
+	return BENCH_SCALE_TEST_PREFIX + result;
+}
+
+/*
+ * Measure all benchmark stages for an input
+ * @param input input string reference
+ * @param arguments executor argument list reference
+ * @param warmup warmup run count
+ * @param repetitions measured run count
+ * @param samples stage sample array, indexed by stage type
+ * @return true on success, false otherwise
+ */
+bool 
+bench_measure(
+	const std::string &input,
+	const tok_vector &arguments,
+	size_t warmup,
+	size_t repetitions,
+	bench_sample samples[MAX_BENCH_STAGE + 1]
+	)
+{
+	bool result = true;
+	size_t i, stage = 0;
+	std::stringstream sink;
+	unsigned long long allocations, start;
+	std::vector<unsigned long long> times;
+	std::streambuf *output = std::cout.rdbuf();
+
+	if(!repetitions) {
+		repetitions = 1;
+	}
+
+	try {
+
+		for(; stage <= MAX_BENCH_STAGE; ++stage) {
+			times.clear();
+			std::cout.rdbuf(sink.rdbuf());
+
+			for(i = 0; i < warmup; ++i) {
+				bench_run_stage(stage, input, arguments);
+				sink.str(std::string());
+			}
+			allocations = bench_allocations;
+
+			for(i = 0; i < repetitions; ++i) {
+				start = clk::now();
+				samples[stage].units = bench_run_stage(stage, input, arguments);
+				times.push_back(clk::now() - start);
+				sink.str(std::string());
+			}
+			std::cout.rdbuf(output);
+			std::sort(times.begin(), times.end());
+			samples[stage].allocations = (bench_allocations - allocations) / repetitions;
+			samples[stage].time = times.at(times.size() / 2);
+		}
+	} catch(std::runtime_error &exc) {
+		std::cout.rdbuf(output);
+		std::cerr << "Exception: " << exc.what() << std::endl;
+		result = false;
+	}
+
+	return result;
+}
+
+/*
+ * Retrieve a stage rate
+ * @param sample stage sample reference
+ * @return processed units per second
+ */
+double 
+bench_rate(
+	const bench_sample &sample
+	)
+{
+	return sample.time ? (sample.units * (double) CLK_NSEC_PER_SEC) / sample.time : 0.0;
+}
+
+/*
+ * Report stage samples, comparing rates against a baseline
+ * @param name sample set name
+ * @param samples stage sample array, indexed by stage type
+ * @param threshold fractional slowdown reported as a regression
+ * @param baseline_rate baseline rates, keyed by sample set and stage
+ * @param record output baseline record stream
+ * @return regression count
+ */
+int 
+bench_report(
+	const std::string &name,
+	bench_sample samples[MAX_BENCH_STAGE + 1],
+	double threshold,
+	std::map<std::string, double> &baseline_rate,
+	std::stringstream &record
+	)
+{
+	double change, rate;
+	int result = 0;
+	size_t stage = 0;
+	std::string key;
+	std::map<std::string, double>::iterator entry;
+
+	std::cout << std::left << std::setw(10) << "stage" << std::right << std::setw(12) << "count" << std::setw(12) << "unit" 
+		<< std::setw(12) << "median ms" << std::setw(16) << "units/s" << std::setw(12) << "allocs" << std::setw(10) << "change" << std::endl;
+
+	for(; stage <= MAX_BENCH_STAGE; ++stage) {
+		key = name + "/" + BENCH_STAGE_STRING(stage);
+		rate = bench_rate(samples[stage]);
+		record << key << " " << std::fixed << std::setprecision(1) << rate << std::endl;
+		std::cout << std::left << std::setw(10) << BENCH_STAGE_STRING(stage) << std::right << std::setw(12) << samples[stage].units 
+			<< std::setw(12) << BENCH_STAGE_UNIT_STRING(stage) << std::fixed << std::setprecision(3) << std::setw(12) 
+			<< (samples[stage].time / 1000000.0) << std::setprecision(1) << std::setw(16) << rate << std::setw(12) 
+			<< samples[stage].allocations;
+		entry = baseline_rate.find(key);
+
+		if(entry != baseline_rate.end()
+				&& entry->second > 0.0) {
+			change = (rate - entry->second) / entry->second;
+			std::cout << std::setw(9) << (change * 100.0) << "%";
+
+			if(change < -threshold) {
+				std::cout << "  REGRESSION";
+				++result;
+			}
+		}
+		std::cout << std::endl;
+	}
+
+	return result;
+}
+
+bool 
+bench_scale_test(
+	const gen_config &config,
+	size_t param,
+	size_t step,
+	size_t warmup,
+	size_t repetitions,
+	bench_sample samples[MAX_BENCH_STAGE + 1]
+	)
+{
+	bool result;
+	gen_config scaled = config;
+	std::string prefix = bench_temp_path(BENCH_SCALE_MODULE_PREFIX);
+
+	scaled.param[param] = bench_scale_value(config, param, step);
+
+	if(!gen_write_modules(scaled, prefix)) {
+		gen_remove_modules(scaled, prefix);
+		std::cerr << "Failed to write benchmark modules: " << prefix << std::endl;
+		return false;
+	}
+	result = bench_measure(gen_program(scaled, prefix), tok_vector(), warmup, repetitions, samples);
+	gen_remove_modules(scaled, prefix);
+
+	return result;
+}
+
+size_t 
+bench_scale_value(
+	const gen_config &config,
+	size_t param,
+	size_t step
+	)
+{
+	size_t result = config.param[param] / BENCH_SCALE_DIVISOR;
+
+	return (result ? result : 1) << step;
+}
+
+std::string 
+bench_temp_path(
+	const std::string &name
+	)
+{
+	std::string result;
+#ifdef _WIN32
+	char directory[MAX_PATH + 1];
+	DWORD length = GetTempPathA(MAX_PATH + 1, directory);
+
+	if(length
+			&& (length <= MAX_PATH)) {
+		result.assign(directory, length);
+	}
+#else
+	const char *directory = std::getenv("TMPDIR");
+
+	result = (directory && *directory) ? directory : "/tmp";
+
+	if(result.at(result.size() - 1) != '/') {
+		result += "/";
+	}
+#endif
+
+	return result + name;
+}
+
+bool 
+bench_test(
+	size_t test,
+	size_t warmup,
+	size_t repetitions,
+	bench_sample samples[MAX_BENCH_STAGE + 1]
+	)
+{
+	bool result;
+	tok scratch;
+	std::string input, path = bench_temp_path(BENCH_SCRATCH_FILE);
+
+	if(!bench_read_input(test, input)) {
+		std::cerr << "Failed to read benchmark input: " << BENCH_TEST_PATH_STRING(test) << std::endl;
+		return false;
+	}
+	scratch.set_as_token(TOKEN_TYPE_VAR_STRING, INVALID_TYPE);
+	scratch.set_value(path);
+	result = bench_measure(input, tok_vector(1, scratch), warmup, repetitions, samples);
+	std::remove(path.c_str());
+
+	return result;
+}
+
+bool 
+bench_test_all(
+	const gen_config &config,
+	size_t param,
+	size_t warmup,
+	size_t repetitions,
+	double threshold,
+	const std::string &baseline,
+	const std::string &output
+	)
+{
+	double rate;
+	std::string key;
+	std::stringstream name, record;
+	int fail = 0, regress = 0, superlinear = 0;
+	size_t stage, step, test = 0, value[BENCH_SCALE_STEPS];
+	std::map<std::string, double> baseline_rate;
+	bench_sample samples[MAX_BENCH_STAGE + 1], first[MAX_BENCH_STAGE + 1];
+	double exponent[MAX_BENCH_STAGE + 1];
+
+	if(!baseline.empty()) {
+		std::ifstream file(baseline.c_str());
+
+		if(!file) {
+			std::cerr << "Failed to read benchmark baseline: " << baseline << std::endl;
+			return false;
+		}
+
+		while(file >> key >> rate) {
+			baseline_rate[key] = rate;
+		}
+	}
+
+	for(; test <= MAX_BENCH_TEST; ++test) {
+		std::cout << "[" << test << "] " << BENCH_TEST_STRING(test) << std::endl << "------------------------" << std::endl;
+
+		if(!bench_test(test, warmup, repetitions, samples)) {
+			std::cout << "RESULT: FAIL" << std::endl << std::endl;
+			++fail;
+			continue;
+		}
+		regress += bench_report(BENCH_TEST_STRING(test), samples, threshold, baseline_rate, record);
+		std::cout << std::endl;
+	}
+	std::cout << "[" << test << "] " << bench_scale_name(param) << std::endl << "------------------------" << std::endl;
+
+	for(step = 0; step < BENCH_SCALE_STEPS; ++step) {
+		value[step] = bench_scale_value(config, param, step);
+		std::cout << GEN_PARAM_STRING(param) << "=" << value[step] << std::endl;
+
+		if(!bench_scale_test(config, param, step, warmup, repetitions, samples)) {
+			std::cout << "RESULT: FAIL" << std::endl << std::endl;
+			++fail;
+			break;
+		}
+
+		if(!step) {
+			std::copy(samples, samples + MAX_BENCH_STAGE + 1, first);
+		}
+		name.str(std::string());
+		name << bench_scale_name(param) << "_" << value[step];
+		regress += bench_report(name.str(), samples, threshold, baseline_rate, record);
+		std::cout << std::endl;
+	}
+
+	if(step == BENCH_SCALE_STEPS) {
+		std::cout << "growth exponent (time ~ " << GEN_PARAM_STRING(param) << "^k)" << std::endl;
+
+		for(stage = 0; stage <= MAX_BENCH_STAGE; ++stage) {
+			exponent[stage] = (first[stage].time && samples[stage].time) 
+				? std::log((double) samples[stage].time / first[stage].time) / std::log((double) value[step - 1] / value[0]) : 0.0;
+			std::cout << std::left << std::setw(10) << BENCH_STAGE_STRING(stage) << std::right << std::fixed 
+				<< std::setprecision(2) << std::setw(12) << exponent[stage];
+
+			if(exponent[stage] > BENCH_SCALE_SUPERLINEAR) {
+				std::cout << "  SUPERLINEAR";
+				++superlinear;
+			}
+			std::cout << std::endl;
+		}
+		std::cout << std::endl;
+	}
+
+	if(!output.empty()) {
+		std::ofstream file(output.c_str(), std::ios::out | std::ios::trunc);
+
+		if(!file) {
+			std::cerr << "Failed to write benchmark baseline: " << output << std::endl;
+			++fail;
+		} else {
+			file << record.str();
+		}
+	}
+	std::cout << "DONE. FAILED: " << fail << ", REGRESSED: " << regress << ", SUPERLINEAR: " << superlinear 
+		<< " (threshold " << std::setprecision(1) << (threshold * 100.0) << "%)" << std::endl;
+
+	return !fail && !regress && !superlinear;
+}
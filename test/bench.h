@@ -0,0 +1,123 @@
+/*
+ * bench.h
+ * Copyright (C) 2013 David Jolly
+ * ----------------------
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef BENCH_H_
+#define BENCH_H_
+
+#include "bench_type.h"
+#include "gen.h"
+
+/*
+ * Benchmark stage sample
+ * (time is the median of all repetitions, in nanoseconds; units and
+ * allocations are per run)
+ */
+typedef struct _bench_sample {
+	unsigned long long allocations;
+	unsigned long long time;
+	size_t units;
+} bench_sample, *bench_sample_ptr;
+
+/*
+ * Count an allocation
+ * (called by a benchmark executable which replaces the global allocator;
+ * allocations are reported as zero otherwise)
+ */
+extern void bench_add_allocation(void);
+
+/*
+ * Invoke a benchmark scaling step on a generated program
+ * @param config generator configuration reference
+ * @param param scaled generator parameter type
+ * @param step scaling step
+ * @param warmup warmup run count
+ * @param repetitions measured run count
+ * @param samples stage sample array, indexed by stage type
+ * @return true on success, false otherwise
+ */
+extern bool bench_scale_test(
+	const gen_config &config,
+	size_t param,
+	size_t step,
+	size_t warmup,
+	size_t repetitions,
+	bench_sample samples[MAX_BENCH_STAGE + 1]
+	);
+
+/*
+ * Retrieve a scaled generator parameter value
+ * (steps double the value, starting from a quarter of the configured value)
+ * @param config generator configuration reference
+ * @param param scaled generator parameter type
+ * @param step scaling step
+ * @return scaled parameter value
+ */
+extern size_t bench_scale_value(
+	const gen_config &config,
+	size_t param,
+	size_t step
+	);
+
+/*
+ * Retrieve a path in the temporary directory
+ * @param name file name string reference
+ * @return temporary file path string
+ */
+extern std::string bench_temp_path(
+	const std::string &name
+	);
+
+/*
+ * Invoke benchmark test
+ * @param test benchmark test type
+ * @param warmup warmup run count
+ * @param repetitions measured run count
+ * @param samples stage sample array, indexed by stage type
+ * @return true on success, false otherwise
+ */
+extern bool bench_test(
+	size_t test,
+	size_t warmup,
+	size_t repetitions,
+	bench_sample samples[MAX_BENCH_STAGE + 1]
+	);
+
+/*
+ * Invoke all benchmark tests and a scaling curve over one generator
+ * parameter, comparing rates against a baseline
+ * @param config generator configuration reference
+ * @param param scaled generator parameter type
+ * @param warmup warmup run count
+ * @param repetitions measured run count
+ * @param threshold fractional slowdown reported as a regression
+ * @param baseline baseline file path, empty to skip comparison
+ * @param output output baseline file path, empty to skip writing
+ * @return true if all tests ran without regression or superlinear growth, false otherwise
+ */
+extern bool bench_test_all(
+	const gen_config &config,
+	size_t param,
+	size_t warmup,
+	size_t repetitions,
+	double threshold,
+	const std::string &baseline,
+	const std::string &output
+	);
+
+#endif
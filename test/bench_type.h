@@ -0,0 +1,132 @@
+/*
+ * bench_type.h
+ * Copyright (C) 2013 David Jolly
+ * ----------------------
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef BENCH_TYPE_H_
+#define BENCH_TYPE_H_
+
+#include <string>
+#include "gen_type.h"
+
+/*
+ * Benchmark stage types
+ */
+enum {
+	BENCH_STAGE_LEXER = 0,
+	BENCH_STAGE_PARSER,
+	BENCH_STAGE_EXECUTOR,
+};
+
+/*
+ * Benchmark test types
+ */
+enum {
+	BENCH_FILE_IO_TEST = 0,
+	BENCH_LIST_TEST,
+	BENCH_NUMERIC_LOOP_TEST,
+	BENCH_OUTPUT_TEST,
+	BENCH_RECURSION_TEST,
+	BENCH_STRING_BUILD_TEST,
+};
+
+/*
+ * Max benchmark types
+ */
+#define MAX_BENCH_STAGE BENCH_STAGE_EXECUTOR
+#define MAX_BENCH_TEST BENCH_STRING_BUILD_TEST
+
+/*
+ * Benchmark defaults
+ * (threshold is the fractional slowdown against the baseline rate
+ * reported as a regression)
+ */
+#define BENCH_DEFAULT_REPETITIONS 5
+#define BENCH_DEFAULT_THRESHOLD 0.1
+#define BENCH_DEFAULT_WARMUP 1
+
+/*
+ * Benchmark command line
+ * (every flag except help is followed by a value)
+ */
+#define BENCH_FLAG_HELP "-h"
+#define BENCH_FLAG_VALUES "bgoprstw"
+#define BENCH_USAGE "Usage: nbbench [-h] [-w warmup] [-r repetitions] [-t threshold] [-b baseline] [-o output]"\
+	" [-p name=value]... [-s scaled parameter] [-g generated program]"
+
+/*
+ * Benchmark scratch file
+ * (created in the temporary directory, passed to each workload as its
+ * first argument and removed afterwards)
+ */
+#define BENCH_SCRATCH_FILE "nbbench_scratch.txt"
+
+/*
+ * Benchmark scaling parameters
+ * (each step doubles the scaled generator parameter; a growth exponent
+ * above the superlinear bound is flagged)
+ */
+#define BENCH_SCALE_DIVISOR 4
+#define BENCH_SCALE_MODULE_PREFIX "bench_scale" GEN_MODULE_INFIX
+#define BENCH_SCALE_STEPS 4
+#define BENCH_SCALE_SUPERLINEAR 1.5
+#define BENCH_SCALE_TEST_PREFIX "BENCH_SCALE_"
+
+/*
+ * Benchmark strings
+ */
+static const std::string BENCH_STAGE_STR[] = {
+	"lexer", "parser", "executor",
+};
+
+static const std::string BENCH_STAGE_UNIT_STR[] = {
+	"tokens", "statements", "statements",
+};
+
+static const std::string BENCH_TEST_STR[] = {
+	"BENCH_FILE_IO_TEST",
+	"BENCH_LIST_TEST",
+	"BENCH_NUMERIC_LOOP_TEST",
+	"BENCH_OUTPUT_TEST",
+	"BENCH_RECURSION_TEST",
+	"BENCH_STRING_BUILD_TEST",
+};
+
+static const std::string BENCH_TEST_PATH[] = {
+	"../../../test/bench_test/bench_file_io_test.nb",
+	"../../../test/bench_test/bench_list_test.nb",
+	"../../../test/bench_test/bench_numeric_loop_test.nb",
+	"../../../test/bench_test/bench_output_test.nb",
+	"../../../test/bench_test/bench_recursion_test.nb",
+	"../../../test/bench_test/bench_string_build_test.nb",
+};
+
+/*
+ * Benchmark string lookup macros
+ */
+#define BENCH_STAGE_STRING(_T_) (_T_ > MAX_BENCH_STAGE ? "Unknown benchmark stage" : BENCH_STAGE_STR[_T_])
+#define BENCH_STAGE_UNIT_STRING(_T_) (_T_ > MAX_BENCH_STAGE ? "Unknown benchmark stage unit" : BENCH_STAGE_UNIT_STR[_T_])
+#define BENCH_TEST_STRING(_T_) (_T_ > MAX_BENCH_TEST ? "Unknown benchmark test" : BENCH_TEST_STR[_T_])
+#define BENCH_TEST_PATH_STRING(_T_) (_T_ > MAX_BENCH_TEST ? "Unknown benchmark test path" : BENCH_TEST_PATH[_T_])
+
+/*
+ * Benchmark command line macros
+ */
+#define IS_BENCH_VALUE_FLAG(_S_) ((_S_.size() == 2) && (_S_.at(0) == '-')\
+	&& (std::string(BENCH_FLAG_VALUES).find(_S_.at(1)) != std::string::npos))
+
+#endif
@@ -0,0 +1,345 @@
+/*
+ * gen.cpp
+ * Copyright (C) 2013 David Jolly
+ * ----------------------
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <sstream>
+#include "gen.h"
+
+/*
+ * Advance generator state
+ * (a fixed linear congruential generator, so output does not depend on
+ * the platform rand implementation)
+ * @param state generator state reference
+ * @return next pseudo-random value
+ */
+size_t 
+gen_next(
+	unsigned int &state
+	)
+{
+	state = (state * 1103515245) + 12345;
+
+	return (state >> 0x10) & 0x7fff;
+}
+
+/*
+ * Generate an expression
+ * @param config generator configuration reference
+ * @param state generator state reference
+ * @param operand leading operand string
+ * @return expression string
+ */
+std::string 
+gen_expression(
+	const gen_config &config,
+	unsigned int &state,
+	const std::string &operand
+	)
+{
+	size_t i = 0;
+	std::stringstream result;
+
+	result << operand;
+
+	for(; i < config.param[GEN_PARAM_WIDTH]; ++i) {
+		result << ((gen_next(state) % 2) ? " + " : " - ") << "v" << (gen_next(state) % GEN_VARIABLE_COUNT);
+
+		if(!(gen_next(state) % 3)) {
+			result << " * " << ((gen_next(state) % 4) + 1);
+		}
+	}
+
+	return result.str();
+}
+
+/*
+ * Generate a function definition
+ * @param config generator configuration reference
+ * @param state generator state reference
+ * @param name function name string
+ * @return function definition string
+ */
+std::string 
+gen_function(
+	const gen_config &config,
+	unsigned int &state,
+	const std::string &name
+	)
+{
+	std::stringstream result;
+
+	result << "set: " << name << "(x) { set: y, " << gen_expression(config, state, "x") << "; } y;" << std::endl;
+
+	return result.str();
+}
+
+/*
+ * Generate a string literal
+ * @param config generator configuration reference
+ * @param state generator state reference
+ * @return string literal string
+ */
+std::string 
+gen_literal(
+	const gen_config &config,
+	unsigned int &state
+	)
+{
+	size_t i = 0;
+	std::string result = "'";
+
+	for(; i < config.param[GEN_PARAM_LITERAL]; ++i) {
+		result += (char) ('a' + (gen_next(state) % 26));
+	}
+	result += "'";
+
+	return result;
+}
+
+/*
+ * Generate a top-level statement
+ * @param config generator configuration reference
+ * @param state generator state reference
+ * @param index statement index
+ * @return statement string
+ */
+std::string 
+gen_statement(
+	const gen_config &config,
+	unsigned int &state,
+	size_t index
+	)
+{
+	size_t i = 0, function;
+	std::stringstream result;
+	size_t depth = config.param[GEN_PARAM_DEPTH], functions = config.param[GEN_PARAM_FUNCTIONS], 
+		uses = config.param[GEN_PARAM_USES];
+
+	switch(index % (MAX_GEN_STMT + 1)) {
+		case GEN_STMT_STRING:
+			result << "set: s, s + " << gen_literal(config, state) << " + v" << (gen_next(state) % GEN_VARIABLE_COUNT) << ";";
+			break;
+		case GEN_STMT_CALL:
+
+			if(!functions) {
+				result << "set: r, " << gen_expression(config, state, "0") << ";";
+				break;
+			}
+			function = gen_next(state) % (functions * (uses + 1));
+			result << "set: r, ";
+
+			if(function >= functions) {
+				result << "m" << ((function / functions) - 1) << "_";
+			}
+			result << "f" << (function % functions) << "(" << gen_expression(config, state, "0") << ");";
+			break;
+		case GEN_STMT_LIST:
+			result << "lpush: l, " << gen_expression(config, state, "0") << ";";
+			break;
+		case GEN_STMT_CONDITIONAL:
+
+			for(; i < depth; ++i) {
+				result << "if: (lt? v" << (gen_next(state) % GEN_VARIABLE_COUNT) << ", " << (GEN_VARIABLE_COUNT + i) << ") { ";
+			}
+			result << "set: r, " << gen_expression(config, state, "0") << ";";
+
+			for(i = 0; i < depth; ++i) {
+				result << " }";
+			}
+			break;
+		case GEN_STMT_RANGE:
+			result << "set: i, 0;" << std::endl << "range: lt? i, " << GEN_RANGE_COUNT << ", posi: i; { set: r, " 
+				<< gen_expression(config, state, "i") << "; }";
+			break;
+		case GEN_STMT_ARITHMETIC:
+		default:
+			result << "set: r, " << gen_expression(config, state, "0") << ";";
+			break;
+	}
+	result << std::endl;
+
+	return result.str();
+}
+
+void 
+gen_config_default(
+	gen_config &config
+	)
+{
+	config.param[GEN_PARAM_DEPTH] = GEN_DEFAULT_DEPTH;
+	config.param[GEN_PARAM_FUNCTIONS] = GEN_DEFAULT_FUNCTIONS;
+	config.param[GEN_PARAM_LITERAL] = GEN_DEFAULT_LITERAL;
+	config.param[GEN_PARAM_STATEMENTS] = GEN_DEFAULT_STATEMENTS;
+	config.param[GEN_PARAM_USES] = GEN_DEFAULT_USES;
+	config.param[GEN_PARAM_WIDTH] = GEN_DEFAULT_WIDTH;
+	config.seed = GEN_DEFAULT_SEED;
+}
+
+bool 
+gen_config_set(
+	gen_config &config,
+	const std::string &assignment
+	)
+{
+	char *end = NULL;
+	size_t param = 0;
+	unsigned long value;
+	std::string::size_type pos = assignment.find('=');
+
+	if(pos == std::string::npos
+			|| pos + 1 >= assignment.size()) {
+		return false;
+	}
+	value = std::strtoul(assignment.c_str() + pos + 1, &end, 0);
+
+	if(*end) {
+		return false;
+	}
+
+	if(assignment.substr(0, pos) == "seed") {
+		config.seed = (unsigned int) value;
+		return true;
+	}
+
+	for(; param <= MAX_GEN_PARAM; ++param) {
+
+		if(assignment.substr(0, pos) == GEN_PARAM_STRING(param)) {
+			config.param[param] = (size_t) value;
+			return true;
+		}
+	}
+
+	return false;
+}
+
+std::string 
+gen_module(
+	const gen_config &config,
+	size_t index
+	)
+{
+	size_t i = 0;
+	std::stringstream result, name;
+	unsigned int state = config.seed + (unsigned int) index + 1;
+
+	result << "# generated module " << index << std::endl << std::endl;
+
+	for(; i < GEN_VARIABLE_COUNT; ++i) {
+		result << "set: v" << i << ", " << (i + 1) << ";" << std::endl;
+	}
+
+	for(i = 0; i < config.param[GEN_PARAM_FUNCTIONS]; ++i) {
+		name.str(std::string());
+		name << "m" << index << "_f" << i;
+		result << gen_function(config, state, name.str());
+	}
+
+	return result.str();
+}
+
+std::string 
+gen_module_path(
+	const std::string &prefix,
+	size_t index
+	)
+{
+	std::stringstream result;
+
+	result << prefix << index << GEN_MODULE_EXTENSION;
+
+	return result.str();
+}
+
+std::string 
+gen_program(
+	const gen_config &config,
+	const std::string &prefix
+	)
+{
+	size_t i = 0;
+	std::stringstream result, name;
+	unsigned int state = config.seed;
+
+	result << "# generated program (";
+
+	for(; i <= MAX_GEN_PARAM; ++i) {
+		result << (i ? ", " : "") << GEN_PARAM_STRING(i) << "=" << config.param[i];
+	}
+	result << ", seed=" << config.seed << ")" << std::endl << std::endl;
+
+	for(i = 0; i < config.param[GEN_PARAM_USES]; ++i) {
+		result << "use: '" << gen_module_path(prefix, i) << "';" << std::endl;
+	}
+
+	for(i = 0; i < GEN_VARIABLE_COUNT; ++i) {
+		result << "set: v" << i << ", " << (i + 1) << ";" << std::endl;
+	}
+	result << "set: i, 0;" << std::endl << "set: l, 0;" << std::endl << "set: r, 0;" << std::endl 
+		<< "set: s, '';" << std::endl;
+
+	for(i = 0; i < config.param[GEN_PARAM_FUNCTIONS]; ++i) {
+		name.str(std::string());
+		name << "f" << i;
+		result << gen_function(config, state, name.str());
+	}
+	result << std::endl;
+
+	for(i = 0; i < config.param[GEN_PARAM_STATEMENTS]; ++i) {
+		result << gen_statement(config, state, i);
+	}
+
+	return result.str();
+}
+
+void 
+gen_remove_modules(
+	const gen_config &config,
+	const std::string &prefix
+	)
+{
+	size_t i = 0;
+
+	for(; i < config.param[GEN_PARAM_USES]; ++i) {
+		std::remove(gen_module_path(prefix, i).c_str());
+	}
+}
+
+bool 
+gen_write_modules(
+	const gen_config &config,
+	const std::string &prefix
+	)
+{
+	size_t i = 0;
+	bool result = true;
+
+	for(; result && (i < config.param[GEN_PARAM_USES]); ++i) {
+		std::ofstream file(gen_module_path(prefix, i).c_str(), std::ios::out | std::ios::trunc);
+
+		if(!file) {
+			result = false;
+		} else {
+			file << gen_module(config, i);
+		}
+	}
+
+	return result;
+}
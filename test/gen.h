@@ -0,0 +1,112 @@
+/*
+ * gen.h
+ * Copyright (C) 2013 David Jolly
+ * ----------------------
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef GEN_H_
+#define GEN_H_
+
+#include "gen_type.h"
+
+/*
+ * Generator configuration
+ * (parameters are indexed by generator parameter type)
+ */
+typedef struct _gen_config {
+	size_t param[MAX_GEN_PARAM + 1];
+	unsigned int seed;
+} gen_config, *gen_config_ptr;
+
+/*
+ * Initialize a generator configuration with default parameters
+ * @param config generator configuration reference
+ */
+extern void gen_config_default(
+	gen_config &config
+	);
+
+/*
+ * Set a generator configuration parameter from a "name=value" string
+ * @param config generator configuration reference
+ * @param assignment parameter assignment string
+ * @return true on success, false if the name or value is invalid
+ */
+extern bool gen_config_set(
+	gen_config &config,
+	const std::string &assignment
+	);
+
+/*
+ * Generate a module source
+ * (defines one variable and the configured number of functions, all
+ * prefixed with the module name)
+ * @param config generator configuration reference
+ * @param index module index
+ * @return module source string
+ */
+extern std::string gen_module(
+	const gen_config &config,
+	size_t index
+	);
+
+/*
+ * Retrieve a module path
+ * @param prefix module path prefix
+ * @param index module index
+ * @return module path string
+ */
+extern std::string gen_module_path(
+	const std::string &prefix,
+	size_t index
+	);
+
+/*
+ * Generate a program source
+ * (the same configuration and seed always produce the same program;
+ * modules are referenced through use statements and must be written
+ * with gen_write_modules before the program is executed)
+ * @param config generator configuration reference
+ * @param prefix module path prefix
+ * @return program source string
+ */
+extern std::string gen_program(
+	const gen_config &config,
+	const std::string &prefix
+	);
+
+/*
+ * Remove modules written by gen_write_modules
+ * @param config generator configuration reference
+ * @param prefix module path prefix
+ */
+extern void gen_remove_modules(
+	const gen_config &config,
+	const std::string &prefix
+	);
+
+/*
+ * Write all modules referenced by a program
+ * @param config generator configuration reference
+ * @param prefix module path prefix
+ * @return true on success, false otherwise
+ */
+extern bool gen_write_modules(
+	const gen_config &config,
+	const std::string &prefix
+	);
+
+#endif
@@ -0,0 +1,88 @@
+/*
+ * gen_type.h
+ * Copyright (C) 2013 David Jolly
+ * ----------------------
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef GEN_TYPE_H_
+#define GEN_TYPE_H_
+
+#include <string>
+
+/*
+ * Generator parameter types
+ */
+enum {
+	GEN_PARAM_DEPTH = 0,
+	GEN_PARAM_FUNCTIONS,
+	GEN_PARAM_LITERAL,
+	GEN_PARAM_STATEMENTS,
+	GEN_PARAM_USES,
+	GEN_PARAM_WIDTH,
+};
+
+/*
+ * Generator statement types
+ * (generated top-level statements cycle through these)
+ */
+enum {
+	GEN_STMT_ARITHMETIC = 0,
+	GEN_STMT_STRING,
+	GEN_STMT_CALL,
+	GEN_STMT_LIST,
+	GEN_STMT_CONDITIONAL,
+	GEN_STMT_RANGE,
+};
+
+/*
+ * Max generator types
+ */
+#define MAX_GEN_PARAM GEN_PARAM_WIDTH
+#define MAX_GEN_STMT GEN_STMT_RANGE
+
+/*
+ * Generator defaults
+ */
+#define GEN_DEFAULT_DEPTH 3
+#define GEN_DEFAULT_FUNCTIONS 8
+#define GEN_DEFAULT_LITERAL 0x10
+#define GEN_DEFAULT_SEED 0x4e42
+#define GEN_DEFAULT_STATEMENTS 0x100
+#define GEN_DEFAULT_USES 0
+#define GEN_DEFAULT_WIDTH 4
+
+/*
+ * Generator limits
+ * (variables are assigned once, read afterwards, so values stay bounded)
+ */
+#define GEN_MODULE_EXTENSION ".nb"
+#define GEN_MODULE_INFIX "_module_"
+#define GEN_RANGE_COUNT 3
+#define GEN_VARIABLE_COUNT 8
+
+/*
+ * Generator parameter strings
+ */
+static const std::string GEN_PARAM_STR[] = {
+	"depth", "functions", "literal", "statements", "uses", "width",
+};
+
+/*
+ * Generator parameter string lookup macro
+ */
+#define GEN_PARAM_STRING(_T_) (_T_ > MAX_GEN_PARAM ? "Unknown generator parameter" : GEN_PARAM_STR[_T_])
+
+#endif
@@ -17,11 +17,15 @@
  * along with this program.  If not, see <http://www.gnu.org/licenses/>.
  */
 
+#include <cstdio>
+#include <fstream>
 #include <iostream>
 #include <map>
+#include <sstream>
 #include <stdexcept>
 #include "..\src\nblang\exe.h"
 #include "..\src\nblang\exe_ext.h"
+#include "..\src\nblang\exe_ext_type.h"
 #include "..\src\nblang\lang.h"
 #include "..\src\nblang\lex.h"
 #include "..\src\nblang\lex_ext.h"
@@ -29,6 +33,256 @@
 #include "..\src\nblang\par_ext.h"
 #include "regress.h"
 
+/*
+ * Read a file into a string
+ * @param path file path
+ * @return file contents, or an empty string if the file could not be opened
+ */
+static std::string 
+exe_regress_read_file(
+	const std::string &path
+	)
+{
+	std::stringstream ss;
+	std::ifstream file(path.c_str(), std::ios::in | std::ios::binary);
+
+	if(file) {
+		ss << file.rdbuf();
+	}
+
+	return ss.str();
+}
+
+/*
+ * Check that evaluation aborts once a statement budget is exhausted
+ * @param exec executor object reference
+ * @return true on success, false otherwise
+ */
+static bool 
+exe_regress_budget_abort_test(
+	exe &exec
+	)
+{
+	bool result = true;
+
+	exec.get_budget().set_limit(BUD_LIMIT_STATEMENT, EXE_BUDGET_ABORT_TEST_LIMIT);
+
+	if(exec.evaluate() != EXE_SIG_ABORT) {
+		std::cerr << "Statement budget was not enforced" << std::endl;
+		result = false;
+	} else if(exec.get_budget().get_exhausted() != BUD_LIMIT_STATEMENT) {
+		std::cerr << "Unexpected budget exhausted: " << BUD_LIMIT_STRING(exec.get_budget().get_exhausted()) << std::endl;
+		result = false;
+	} else {
+		std::cout << BUD_LIMIT_STRING(exec.get_budget().get_exhausted()) << " budget exhausted" << std::endl;
+	}
+
+	return result;
+}
+
+/*
+ * Check that elapsed time is non-negative and increases, including
+ * across initializations that keep the scope
+ * @param exec executor object reference
+ * @return true on success, false otherwise
+ */
+static bool 
+exe_regress_elapsed_test(
+	exe &exec
+	)
+{
+	bool result = true;
+	tok_vector arguments;
+
+	exec.evaluate();
+	exec.initialize(EXE_ELAPSED_TEST_CHECK, arguments, false, false);
+	exec.evaluate();
+	exec.reset(false);
+
+	if(exe_regress_read_file(EXE_ELAPSED_TEST_FILE) != EXE_ELAPSED_TEST_TEXT) {
+		std::cerr << "Elapsed time was negative or did not increase" << std::endl;
+		result = false;
+	}
+	std::remove(EXE_ELAPSED_TEST_FILE);
+
+	return result;
+}
+
+/*
+ * Check that a value read from a mapped file keeps its contents after a
+ * spawned process rewrites the file
+ * @param exec executor object reference
+ * @return true on success, false otherwise
+ */
+static bool 
+exe_regress_mapped_file_test(
+	exe &exec
+	)
+{
+	bool result = true;
+
+	exec.evaluate();
+	exec.reset(false);
+
+	if(exe_regress_read_file(EXE_MAPPED_FILE_TEST_RESULT_FILE) != EXE_MAPPED_FILE_TEST_RESULT_TEXT) {
+		std::cerr << "Mapped value changed with its file" << std::endl;
+		result = false;
+	}
+	std::remove(EXE_MAPPED_FILE_TEST_COPY_FILE);
+	std::remove(EXE_MAPPED_FILE_TEST_FILE);
+	std::remove(EXE_MAPPED_FILE_TEST_RESULT_FILE);
+
+	return result;
+}
+
+/*
+ * Check that evaluation throws once a memory limit is exceeded
+ * @param exec executor object reference
+ * @return true on success, false otherwise
+ */
+static bool 
+exe_regress_memory_limit_test(
+	exe &exec
+	)
+{
+	bool result = false;
+
+	exec.get_memory().set_limit(EXE_MEMORY_LIMIT_TEST_LIMIT);
+
+	try {
+
+		while(exec.has_next()) {
+
+			if(exec.step() == EXE_SIG_EXIT) {
+				break;
+			}
+		}
+	} catch(std::runtime_error &exc) {
+		result = (std::string(exc.what()).find(MEM_EXC_STRING(MEM_EXC_LIMIT_EXCEEDED)) == 0);
+		std::cout << "Limit exceeded: " << exc.what() << std::endl;
+	}
+
+	if(!result) {
+		std::cerr << "Memory limit was not enforced" << std::endl;
+	}
+
+	return result;
+}
+
+/*
+ * Check that batched stdin line reads yield an empty string at end of
+ * input and reject a non-positive line count
+ * @param exec executor object reference
+ * @return true on success, false otherwise
+ */
+static bool 
+exe_regress_stdin_line_test(
+	exe &exec
+	)
+{
+	FILE *input = NULL;
+	bool result = false;
+	tok_vector arguments;
+
+	std::ofstream(EXE_STDIN_LINE_TEST_FILE).close();
+#ifdef _WIN32
+	freopen_s(&input, EXE_STDIN_LINE_TEST_FILE, "r", stdin);
+#else
+	input = std::freopen(EXE_STDIN_LINE_TEST_FILE, "r", stdin);
+#endif
+
+	if(!input) {
+		std::cerr << "Failed to redirect stdin" << std::endl;
+	} else {
+		exec.evaluate();
+		exec.initialize(EXE_STDIN_LINE_TEST_CHECK, arguments, false, false);
+
+		try {
+			exec.evaluate();
+			std::cerr << "Zero line count was accepted" << std::endl;
+		} catch(std::runtime_error &exc) {
+			result = (std::string(exc.what()).find(EXE_EXT_EXC_STRING(EXE_EXT_EXC_INVAL_PARAM)) == 0);
+			std::cout << "Rejected: " << exc.what() << std::endl;
+		}
+	}
+	std::remove(EXE_STDIN_LINE_TEST_FILE);
+
+	return result;
+}
+
+/*
+ * Check that buffered file output is flushed when the executor is reset
+ * @param exec executor object reference
+ * @return true on success, false otherwise
+ */
+static bool 
+exe_regress_stream_reset_test(
+	exe &exec
+	)
+{
+	bool result = true;
+
+	exec.step();
+
+	if(!exe_regress_read_file(EXE_STREAM_RESET_TEST_FILE).empty()) {
+		std::cerr << "Output was flushed before reset" << std::endl;
+		result = false;
+	}
+	exec.reset(false);
+
+	if(exe_regress_read_file(EXE_STREAM_RESET_TEST_FILE) != EXE_STREAM_RESET_TEST_TEXT) {
+		std::cerr << "Output was not flushed on reset" << std::endl;
+		result = false;
+	}
+	std::remove(EXE_STREAM_RESET_TEST_FILE);
+
+	return result;
+}
+
+/*
+ * Check that statements imported with a using statement are not copied
+ * (a small and a large module must cost the same number of tree copies)
+ * @param exec executor object reference
+ * @return true on success, false otherwise
+ */
+static bool 
+exe_regress_using_copy_test(
+	exe &exec
+	)
+{
+	bool result = true;
+	size_t copies, count, imports = 0, import_copies = 0;
+
+	while(exec.has_next()) {
+		copies = tok_stmt::get_copy_count();
+		count = exec.get_count();
+
+		if(exec.step() == EXE_SIG_EXIT) {
+			break;
+		}
+
+		if(exec.get_count() > count) {
+			copies = tok_stmt::get_copy_count() - copies;
+			std::cout << "Imported " << (exec.get_count() - count) << " statements" << std::endl;
+
+			if(imports
+					&& copies != import_copies) {
+				std::cerr << "Import copied statements: " << copies << " tree copies (expected " << import_copies << ")" << std::endl;
+				result = false;
+			}
+			import_copies = copies;
+			++imports;
+		}
+	}
+
+	if(imports < EXE_USING_COPY_TEST_IMPORTS) {
+		std::cerr << "Expected " << EXE_USING_COPY_TEST_IMPORTS << " imports, found " << imports << std::endl;
+		result = false;
+	}
+
+	return result;
+}
+
 bool
 exe_regress_test_helper(
 	const std::string &name,
@@ -48,11 +302,40 @@ exe_regress_test_helper(
 		exec.set_evaluation_action(exe_eval_statement, EXE_EVAL_ACTION_STATEMENT);
 		exec.initialize(input, arguments, is_file, true);
 
-		while(exec.has_next()) {
+		switch(test_id) {
+			case EXE_BUDGET_ABORT_TEST:
+				result = exe_regress_budget_abort_test(exec);
+				break;
+			case EXE_ELAPSED_TEST:
+				std::remove(EXE_ELAPSED_TEST_FILE);
+				result = exe_regress_elapsed_test(exec);
+				break;
+			case EXE_MAPPED_FILE_TEST:
+				std::remove(EXE_MAPPED_FILE_TEST_RESULT_FILE);
+				result = exe_regress_mapped_file_test(exec);
+				break;
+			case EXE_MEMORY_LIMIT_TEST:
+				result = exe_regress_memory_limit_test(exec);
+				break;
+			case EXE_USING_COPY_TEST:
+				result = exe_regress_using_copy_test(exec);
+				break;
+			case EXE_STDIN_LINE_TEST:
+				result = exe_regress_stdin_line_test(exec);
+				break;
+			case EXE_STREAM_RESET_TEST:
+				std::remove(EXE_STREAM_RESET_TEST_FILE);
+				result = exe_regress_stream_reset_test(exec);
+				break;
+			default:
+
+				while(exec.has_next()) {
 			
-			if(exec.step() == EXE_SIG_EXIT) {
+					if(exec.step() == EXE_SIG_EXIT) {
+						break;
+					}
+				}
 				break;
-			}
 		}
 	} catch(std::runtime_error &exc) {
 		std::cerr << "------------------------" << std::endl << "Exception: " << exc.what() << std::endl;
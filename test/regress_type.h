@@ -33,7 +33,14 @@ enum {
  * Regression test types
  */
 enum {
-	EXE_SET_TEST = 0,
+	EXE_BUDGET_ABORT_TEST = 0,
+	EXE_ELAPSED_TEST,
+	EXE_MAPPED_FILE_TEST,
+	EXE_MEMORY_LIMIT_TEST,
+	EXE_SET_TEST,
+	EXE_STDIN_LINE_TEST,
+	EXE_STREAM_RESET_TEST,
+	EXE_USING_COPY_TEST,
 };
 
 enum {
@@ -48,6 +55,7 @@ enum {
 	LEX_CONSTANT_TEST,
 	LEX_CONTROL_TEST,
 	LEX_CONVERSION_OPERATOR_TEST,
+	LEX_EXEC_OPERATOR_TEST,
 	LEX_FILE_STREAM_OPERATOR_TEST,
 	LEX_IN_LIST_OPERATOR_TEST,
 	LEX_IO_OPERATOR_TEST,
@@ -84,7 +92,7 @@ enum {
  * Max regression test types
  */
 #define MAX_REGRESS_TEST PAR_REGRESS_TEST
-#define MAX_EXE_REGRESS_TEST EXE_SET_TEST 
+#define MAX_EXE_REGRESS_TEST EXE_USING_COPY_TEST
 #define MAX_LEX_REGRESS_TEST LEX_USING_OPERATOR_TEST
 #define MAX_PAR_REGRESS_TEST PAR_USING_STATEMENT_TEST
 
@@ -92,7 +100,14 @@ enum {
  * Regression test strings
  */
 static const std::string EXE_REGRESS_TEST_STR[] = {
+	"EXE_BUDGET_ABORT_TEST",
+	"EXE_ELAPSED_TEST",
+	"EXE_MAPPED_FILE_TEST",
+	"EXE_MEMORY_LIMIT_TEST",
 	"EXE_SET_TEST",
+	"EXE_STDIN_LINE_TEST",
+	"EXE_STREAM_RESET_TEST",
+	"EXE_USING_COPY_TEST",
 };
 
 static const std::string LEX_REGRESS_TEST_STR[] = {
@@ -107,6 +122,7 @@ static const std::string LEX_REGRESS_TEST_STR[] = {
 	"LEX_CONSTANT_TEST",
 	"LEX_CONTROL_TEST",
 	"LEX_CONVERSION_OPERATOR_TEST",
+	"LEX_EXEC_OPERATOR_TEST",
 	"LEX_FILE_STREAM_OPERATOR_TEST",
 	"LEX_IN_LIST_OPERATOR_TEST",
 	"LEX_IO_OPERATOR_TEST",
@@ -140,7 +156,14 @@ static const std::string PAR_REGRESS_TEST_STR[] = {
 };
 
 static const std::string EXE_REGRESS_TEST_PATH[] = {
+	"../../../test/exe_regress_test/exe_regress_budget_abort_test.nb",
+	"../../../test/exe_regress_test/exe_regress_elapsed_test.nb",
+	"../../../test/exe_regress_test/exe_regress_mapped_file_test.nb",
+	"../../../test/exe_regress_test/exe_regress_memory_limit_test.nb",
 	"../../../test/exe_regress_test/exe_regress_set_test.nb",
+	"../../../test/exe_regress_test/exe_regress_stdin_line_test.nb",
+	"../../../test/exe_regress_test/exe_regress_stream_reset_test.nb",
+	"../../../test/exe_regress_test/exe_regress_using_copy_test.nb",
 };
 
 static const std::string LEX_REGRESS_TEST_PATH[] = {
@@ -155,6 +178,7 @@ static const std::string LEX_REGRESS_TEST_PATH[] = {
 	"../../../test/lex_regress_test/lex_regress_constant_test.nb",
 	"../../../test/lex_regress_test/lex_regress_control_test.nb",
 	"../../../test/lex_regress_test/lex_regress_conversion_operator_test.nb",
+	"../../../test/lex_regress_test/lex_regress_exec_operator_test.nb",
 	"../../../test/lex_regress_test/lex_regress_file_stream_operator_test.nb",
 	"../../../test/lex_regress_test/lex_regress_in_list_operator_test.nb",
 	"../../../test/lex_regress_test/lex_regress_io_operator_test.nb",
@@ -187,6 +211,48 @@ static const std::string PAR_REGRESS_TEST_PATH[] = {
 	"../../../test/par_regress_test/par_regress_using_statement_test.nb",
 };
 
+/*
+ * Executor budget abort test limit, in statements
+ */
+#define EXE_BUDGET_ABORT_TEST_LIMIT 0x100
+
+/*
+ * Executor elapsed test check, evaluated without clearing scope
+ */
+#define EXE_ELAPSED_TEST_CHECK "set: c, elap: t; if: gte? a, 0 { if: gt? b, a { if: gt? c, b { out: file: append, '" EXE_ELAPSED_TEST_FILE "', '" EXE_ELAPSED_TEST_TEXT "'; } } }"
+#define EXE_ELAPSED_TEST_FILE "exe_regress_elapsed_test.txt"
+#define EXE_ELAPSED_TEST_TEXT "increasing"
+
+/*
+ * Executor mapped file test files and result
+ */
+#define EXE_MAPPED_FILE_TEST_COPY_FILE "exe_regress_mapped_file_test_copy.txt"
+#define EXE_MAPPED_FILE_TEST_FILE "exe_regress_mapped_file_test.txt"
+#define EXE_MAPPED_FILE_TEST_RESULT_FILE "exe_regress_mapped_file_test_result.txt"
+#define EXE_MAPPED_FILE_TEST_RESULT_TEXT "unchanged"
+
+/*
+ * Executor memory limit test limit, in bytes
+ */
+#define EXE_MEMORY_LIMIT_TEST_LIMIT 0x10000
+
+/*
+ * Executor stdin line test input and check, evaluated without clearing scope
+ */
+#define EXE_STDIN_LINE_TEST_CHECK "set: b, in: stdin: line, 0;"
+#define EXE_STDIN_LINE_TEST_FILE "exe_regress_stdin_line_test.txt"
+
+/*
+ * Executor stream reset test output
+ */
+#define EXE_STREAM_RESET_TEST_FILE "exe_regress_stream_reset_test.txt"
+#define EXE_STREAM_RESET_TEST_TEXT "flushed on reset"
+
+/*
+ * Executor using copy test import count
+ */
+#define EXE_USING_COPY_TEST_IMPORTS 2
+
 /*
  * Regression test string lookup macros
  */